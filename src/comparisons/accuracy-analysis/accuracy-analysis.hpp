@@ -0,0 +1,391 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_ANALYSIS_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_ANALYSIS_HPP
+
+// Amplitude accuracy analysis, shared by compare-accuracy and compare-pareto. It lives in the
+// instruction set namespace (see common.hpp), as it is also built into the speed bench sources.
+
+#include <cstddef>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include "xsimd/xsimd.hpp"
+
+#include "../../implementations/common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    using analysis_operand_type = xsimd::batch<double>;
+
+    template<typename T>
+    T clamp(T v, T lo, T hi) {
+        return std::max(std::min(v, hi), lo);
+    }
+
+    struct AmplitudeAccuracyRecord {
+        double freq;
+        double snr_db;
+        double abs_gain_db;
+    };
+
+    struct AnalysisResult {
+        AmplitudeAccuracyRecord worst_snr_record;
+        AmplitudeAccuracyRecord worst_abs_gain_record;
+    };
+
+    inline double dot(
+        std::vector<double>::const_iterator it_a,
+        std::vector<double>::const_iterator it_b,
+        std::size_t size
+    ) {
+        constexpr std::size_t n_lanes = analysis_operand_type::size;
+        analysis_operand_type total_operand(0.);
+        std::size_t i = 0;
+
+        for (; i + n_lanes <= size; i += n_lanes) {
+            total_operand = xsimd::fma(
+                analysis_operand_type::load_unaligned(&it_a[i]), 
+                analysis_operand_type::load_unaligned(&it_b[i]), 
+                total_operand
+            );
+        }
+
+        double total = xsimd::reduce_add(total_operand);
+
+        for (; i < size; i++) {
+            total += it_a[i] * it_b[i];
+        }
+
+        return total;
+    }
+
+    /*
+    Least squares fit of a * sin + b * cos to a window of `size` samples. The model only keeps
+    X.T @ X and its inverse (@ is matrix multiplicaiton); the window sums X.T @ signal are supplied by
+    the caller.
+    */
+    struct LeastSquaresSinCosModel {
+        double freq;
+        double ss;
+        double sc;
+        double cc;
+        double i00;
+        double i01;
+        double i11;
+
+        LeastSquaresSinCosModel(double freq, std::size_t size) : freq(freq) {
+            std::vector<double> steps(size);
+            std::vector<double> sin(size);
+            std::vector<double> cos(size);
+
+            std::iota(steps.begin(), steps.end(), 0.);
+
+            // Calculate sin and cos.
+            std::transform(steps.cbegin(), steps.cend(), sin.begin(), [=](double x){return std::sin(tau<double>() * freq * x);});
+            std::transform(steps.cbegin(), steps.cend(), cos.begin(), [=](double x){return std::cos(tau<double>() * freq * x);});
+
+            // The following calculates X.T @ X for the least squares calculation.
+            // X.T @ X = [[ss, sc], [sc, cc]] where X = [sin, cos].T
+            this->ss = dot(sin.cbegin(), sin.cbegin(), size);
+            this->sc = dot(sin.cbegin(), cos.cbegin(), size);
+            this->cc = dot(cos.cbegin(), cos.cbegin(), size);
+
+            // The following calculates the inverse of (X.T @ X) for the least squares calculation.
+            auto det = this->ss * this->cc - this->sc * this->sc;
+            this->i00 = this->cc / det;
+            this->i01 = -this->sc / det;
+            this->i11 = this->ss / det;
+        }
+    };
+
+    // tau * freq * sample_id, reduced to one cycle before scaling so it stays exact for long signals.
+    inline double phase_at(double freq, std::size_t sample_id) {
+        double cycles = freq * double(sample_id);
+        return tau<double>() * (cycles - std::floor(cycles));
+    }
+
+    // sin(w * n) and cos(w * n) for n < size, with the phases computed as in phase_at.
+    inline void global_phase_sin_cos(double freq, std::size_t size, std::vector<double>& sin_values, std::vector<double>& cos_values) {
+        constexpr std::size_t n_lanes = analysis_operand_type::size;
+
+        sin_values.resize(size);
+        cos_values.resize(size);
+
+        double lane_ids[n_lanes];
+        std::iota(lane_ids, lane_ids + n_lanes, 0.);
+        auto lane_id_operand = analysis_operand_type::load_unaligned(lane_ids);
+
+        std::size_t i = 0;
+
+        for (; i + n_lanes <= size; i += n_lanes) {
+            auto cycles = analysis_operand_type(freq) * (analysis_operand_type(double(i)) + lane_id_operand);
+            auto phase = analysis_operand_type(tau<double>()) * (cycles - xsimd::floor(cycles));
+            xsimd::sin(phase).store_unaligned(&sin_values[i]);
+            xsimd::cos(phase).store_unaligned(&cos_values[i]);
+        }
+
+        for (; i < size; i++) {
+            auto phase = phase_at(freq, i);
+            sin_values[i] = std::sin(phase);
+            cos_values[i] = std::cos(phase);
+        }
+    }
+
+    /*
+    Fit the model to every window of the signal in O(signal.size()) time.
+
+    The signal is split into a fit over the whole signal, r, and the remainder, e = signal - r. The
+    window model spans r, so each window's residual is the residual of fitting e alone; this keeps the
+    residual power from being computed as a difference of (much larger) signal powers. The sums of e
+    against sin and cos are kept at the global phase, sum(e[n] * sin(w * n)) and
+    sum(e[n] * cos(w * n)), which only change by one sample in and one sample out as the window slides.
+    Rotating them by -w * t gives the sums for the window starting at t. The running sums are
+    recomputed from scratch once per window length, so rounding errors do not build up.
+    */
+    inline std::vector<AmplitudeAccuracyRecord> rolling_amplitude_accuracy_analyis_for_freq(const std::vector<double>& signal, double freq) {
+        double osc_size = double(signal.size());
+        double raw_analysis_period_as_double = 2. / (std::abs(freq) + 1. / osc_size);
+        std::size_t analysis_period = clamp(std::size_t(raw_analysis_period_as_double), std::size_t(4), signal.size());
+
+        auto sin_cos_model = LeastSquaresSinCosModel(freq, analysis_period);
+
+        std::vector<AmplitudeAccuracyRecord> accuracy_records;
+
+        std::vector<double> global_sin;
+        std::vector<double> global_cos;
+        global_phase_sin_cos(freq, signal.size(), global_sin, global_cos);
+
+        // Fit r = global_sin_coef * sin(w * n) + global_cos_coef * cos(w * n) over the whole signal.
+        auto global_ss = dot(global_sin.cbegin(), global_sin.cbegin(), signal.size());
+        auto global_sc = dot(global_sin.cbegin(), global_cos.cbegin(), signal.size());
+        auto global_cc = dot(global_cos.cbegin(), global_cos.cbegin(), signal.size());
+        auto global_sin_dot_signal = dot(global_sin.cbegin(), signal.cbegin(), signal.size());
+        auto global_cos_dot_signal = dot(global_cos.cbegin(), signal.cbegin(), signal.size());
+
+        auto global_det = global_ss * global_cc - global_sc * global_sc;
+        auto global_sin_coef = (global_cc * global_sin_dot_signal - global_sc * global_cos_dot_signal) / global_det;
+        auto global_cos_coef = (global_ss * global_cos_dot_signal - global_sc * global_sin_dot_signal) / global_det;
+
+        std::vector<double> remainder(signal.size());
+        for (std::size_t i = 0; i < signal.size(); i++) {
+            remainder[i] = signal[i] - (global_sin_coef * global_sin[i] + global_cos_coef * global_cos[i]);
+        }
+
+        double sin_dot_remainder = 0.;
+        double cos_dot_remainder = 0.;
+        double remainder_power = 0.;
+
+        auto add_sample = [&](std::size_t i, double sign) {
+            sin_dot_remainder += sign * global_sin[i] * remainder[i];
+            cos_dot_remainder += sign * global_cos[i] * remainder[i];
+            remainder_power += sign * remainder[i] * remainder[i];
+        };
+
+        for (std::size_t t = 0; t + analysis_period < signal.size(); t++) {
+            if (t % analysis_period == 0) {
+                sin_dot_remainder = 0.;
+                cos_dot_remainder = 0.;
+                remainder_power = 0.;
+                for (std::size_t i = t; i < t + analysis_period; i++) {
+                    add_sample(i, 1.);
+                }
+            } else {
+                add_sample(t - 1, -1.);
+                add_sample(t + analysis_period - 1, 1.);
+            }
+
+            // Rotate the model to start at t.
+            auto sin_t = global_sin[t];
+            auto cos_t = global_cos[t];
+
+            auto window_sin_dot_remainder = cos_t * sin_dot_remainder - sin_t * cos_dot_remainder;
+            auto window_cos_dot_remainder = cos_t * cos_dot_remainder + sin_t * sin_dot_remainder;
+
+            auto remainder_sin_coef = sin_cos_model.i00 * window_sin_dot_remainder + sin_cos_model.i01 * window_cos_dot_remainder;
+            auto remainder_cos_coef = sin_cos_model.i01 * window_sin_dot_remainder + sin_cos_model.i11 * window_cos_dot_remainder;
+
+            // r is fitted exactly by the window model.
+            auto sin_coef = cos_t * global_sin_coef - sin_t * global_cos_coef + remainder_sin_coef;
+            auto cos_coef = cos_t * global_cos_coef + sin_t * global_sin_coef + remainder_cos_coef;
+
+            double power_gain = sin_coef * sin_coef + cos_coef * cos_coef;
+
+            double fitted_signal_power = (
+                sin_coef * sin_coef * sin_cos_model.ss 
+                + 2. * sin_coef * cos_coef * sin_cos_model.sc 
+                + cos_coef * cos_coef * sin_cos_model.cc
+            );
+
+            double residual_power = std::max(
+                remainder_power - (remainder_sin_coef * window_sin_dot_remainder + remainder_cos_coef * window_cos_dot_remainder),
+                0.
+            );
+
+            AmplitudeAccuracyRecord record;
+            record.freq = freq;
+            record.snr_db = 10 * std::log10(fitted_signal_power / residual_power);
+            record.abs_gain_db = std::abs(10 * std::log10(power_gain));
+            accuracy_records.push_back(record);
+        }
+
+        return accuracy_records;
+    }
+
+    inline AnalysisResult signal_analysis(const std::vector<double>& signal, double freq){
+        AnalysisResult result;
+        std::vector<AmplitudeAccuracyRecord> current_amplitude_accuracy_records;
+
+        current_amplitude_accuracy_records = rolling_amplitude_accuracy_analyis_for_freq(signal, freq);
+        result.worst_snr_record = *(
+            std::min_element(
+                current_amplitude_accuracy_records.cbegin(),
+                current_amplitude_accuracy_records.cend(),
+                [](const AmplitudeAccuracyRecord& a, const AmplitudeAccuracyRecord& b){return a.snr_db < b.snr_db;}
+            )
+        );
+        result.worst_abs_gain_record = *(
+            std::max_element(
+                current_amplitude_accuracy_records.cbegin(),
+                current_amplitude_accuracy_records.cend(),
+                [](const AmplitudeAccuracyRecord& a, const AmplitudeAccuracyRecord& b){return a.abs_gain_db < b.abs_gain_db;}
+            )
+        );
+
+        return result;
+    }
+
+
+    // Worst SNR and worst absolute gain over a set of results (for example, one per frequency).
+    inline AnalysisResult worst_analysis_result(const std::vector<AnalysisResult>& results) {
+        AnalysisResult result;
+
+        result.worst_snr_record = std::min_element(
+            results.cbegin(),
+            results.cend(),
+            [](const AnalysisResult& a, const AnalysisResult& b){return a.worst_snr_record.snr_db < b.worst_snr_record.snr_db;}
+        )->worst_snr_record;
+
+        result.worst_abs_gain_record = std::max_element(
+            results.cbegin(),
+            results.cend(),
+            [](const AnalysisResult& a, const AnalysisResult& b){return a.worst_abs_gain_record.abs_gain_db < b.worst_abs_gain_record.abs_gain_db;}
+        )->worst_abs_gain_record;
+
+        return result;
+    }
+
+    template<typename OscillatorT>
+    AnalysisResult frequency_analysis(double freq, std::size_t analysis_len) {
+        using sample_type = typename OscillatorT::sample_type;
+
+        OscillatorT oscillator(sample_type(0.), sample_type(1.), sample_type(0.));
+
+        std::vector<sample_type> raw_oscillator_signal(analysis_len, 0.);
+        oscillator.reset(sample_type(freq), sample_type(1.), sample_type(0.));
+        oscillator.progress_and_add(raw_oscillator_signal.begin(), raw_oscillator_signal.end());
+
+        std::vector<double> signal(analysis_len);
+        for (std::size_t i = 0; i < analysis_len; i++) {
+            signal[i] = double(raw_oscillator_signal[i]);
+        }
+
+        return signal_analysis(signal, freq);
+    }
+
+    /*
+    Render n_samples samples and analyze only the last analysis_len samples, so that any error that
+    accumulates over time (for example, the drift of a recursive oscillator) shows up. On top of the
+    fitted SNR and gain, the tail is compared against the exact phase-locked cosine; the fit absorbs
+    phase drift, this comparison does not.
+    */
+    template<typename OscillatorT>
+    AnalysisResult long_duration_frequency_analysis(double freq, std::size_t n_samples, std::size_t analysis_len, double& phase_locked_error) {
+        using sample_type = typename OscillatorT::sample_type;
+
+        const std::size_t chunk_size = 4096;
+
+        OscillatorT oscillator(sample_type(0.), sample_type(1.), sample_type(0.));
+        std::vector<sample_type> chunk(chunk_size);
+
+        oscillator.reset(sample_type(freq), sample_type(1.), sample_type(0.));
+
+        std::size_t n_skipped_samples = n_samples - analysis_len;
+        for (std::size_t i = 0; i < n_skipped_samples; i += chunk_size) {
+            auto size = std::min(chunk_size, n_skipped_samples - i);
+            std::fill(chunk.begin(), chunk.begin() + size, sample_type(0.));
+            oscillator.progress_and_add(chunk.begin(), chunk.begin() + size);
+        }
+
+        std::vector<sample_type> raw_oscillator_signal(analysis_len, 0.);
+        oscillator.progress_and_add(raw_oscillator_signal.begin(), raw_oscillator_signal.end());
+
+        std::vector<double> signal(analysis_len);
+        phase_locked_error = 0.;
+        for (std::size_t i = 0; i < analysis_len; i++) {
+            signal[i] = double(raw_oscillator_signal[i]);
+
+            // The reference phase is reduced in long double, so it stays exact over long durations.
+            long double cycles = (long double)(sample_type(freq)) * (long double)(n_skipped_samples + i);
+            cycles -= std::floor(cycles);
+            auto reference = std::cos(tau<double>() * double(cycles));
+            phase_locked_error = std::max(phase_locked_error, std::abs(signal[i] - reference));
+        }
+
+        return signal_analysis(signal, freq);
+    }
+
+
+    template<typename OscillatorT>
+    AnalysisResult oscillator_analysis(const std::vector<double>& freqs, std::size_t analysis_len) {
+        std::vector<AnalysisResult> results_by_freqs;
+
+        for (auto freq : freqs) {
+            results_by_freqs.push_back(frequency_analysis<OscillatorT>(freq, analysis_len));
+        }
+
+        return worst_analysis_result(results_by_freqs);
+    }
+
+    /*
+    Oscillator that is a bank of one oscillator, so that the banks (which have no oscillator type of
+    their own) can go through the same analysis as the oscillators.
+
+    Banks that cross-fade their parameter changes (like InverseFftOscillatorBank) take
+    N_SETTLING_SAMPLES samples to settle after a reset. Each reset renders and drops that many
+    samples, starting early enough for the next sample to still have the requested phase.
+    */
+    template<typename BankT, std::size_t N_SETTLING_SAMPLES = 0>
+    class BankOscillator {
+        using sample_type_ = typename BankT::sample_type;
+
+        BankT bank;
+        std::vector<sample_type_> settling_block;
+
+        public:
+            using sample_type = sample_type_;
+
+            BankOscillator(sample_type freq, sample_type ampl, sample_type phase) : 
+                bank(1), 
+                settling_block(N_SETTLING_SAMPLES) 
+            {
+                this->reset(freq, ampl, phase);
+            }
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                auto settling_phase = tau<sample_type>() * freq * sample_type(N_SETTLING_SAMPLES);
+                this->bank.reset_osc(0, freq, ampl, phase - settling_phase);
+
+                std::fill(this->settling_block.begin(), this->settling_block.end(), sample_type(0.));
+                this->bank.progress_and_add(this->settling_block.begin(), this->settling_block.end());
+            }
+
+            template <typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                this->bank.progress_and_add(signal_begin_it, signal_end_it);
+            }
+        // public
+    };
+}}}
+
+#endif
@@ -0,0 +1,5 @@
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA avx512f
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_MODULE
+#include "accuracy-reports-impl.hpp"
+
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_EXPORT, xsimd::avx512f)
\ No newline at end of file
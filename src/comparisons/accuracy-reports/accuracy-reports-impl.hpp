@@ -0,0 +1,322 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_REPORTS_IMPL_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_REPORTS_IMPL_HPP
+
+// Accuracy report definitions. Only include this from a translation unit that is compiled for one
+// instruction set, after defining GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA.
+
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+#include <string>
+#include <deque>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+#include "../../implementations/common.hpp"
+#include "../../implementations/phase-to-amplitude.hpp"
+#include "../../implementations/recursive.hpp"
+#include "../../implementations/worker-pool.hpp"
+#include "../accuracy-analysis/accuracy-analysis.hpp"
+
+#include "xsimd/xsimd.hpp"
+#include "accuracy-reports.hpp"
+
+namespace xs = xsimd;
+namespace gfac = goldenrockefeller::fast_additive_comparison;
+
+
+using std::cout;
+using std::vector;
+using std::exp2;
+using std::size_t;
+using std::log10;
+using std::invalid_argument;
+using gfac::AnalysisResult;
+using gfac::frequency_analysis;
+using gfac::long_duration_frequency_analysis;
+using gfac::worst_analysis_result;
+
+using FloatCosCalc = gfac::ExactCosineCalculator<float>;
+using DoubleCosCalc = gfac::ExactCosineCalculator<double>;
+using gfac::ApproxCos10Calculator;
+
+using LookupDoubleCosCalc = gfac::LookupCalculator<double>;
+using LinearLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::linear>;
+using CubicLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::cubic>;
+using Linear4096LookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::linear, 4096>;
+using Cubic256FloatLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::cubic, 256, float>;
+
+/*
+Collects accuracy reports, and analyzes all of their frequencies in parallel.
+
+Each add_* call queues one job per frequency; every job renders and analyzes its own oscillator.
+run() spreads the queued jobs, longest first, over a WorkerPool with n_workers workers, then
+prints the reports in the order they were added.
+
+Templated on the architecture, like the rest of this file, so that every instruction set gets its
+own copy.
+*/
+template <class Arch>
+class AccuracyHarness {
+    struct Report {
+        std::string name;
+        vector<double> freqs;
+        size_t n_samples; // Only set for long duration reports.
+        vector<AnalysisResult> results_by_freqs;
+        vector<double> phase_locked_errors_by_freqs;
+    };
+
+    struct Job {
+        size_t n_samples; // Cost estimate, for scheduling.
+        std::function<void()> fn;
+    };
+
+    std::deque<Report> reports; // Reports are not moved when more are added; the jobs point to them.
+    vector<Job> jobs;
+
+    Report& new_report(char const* name, const vector<double>& freqs, size_t n_samples) {
+        Report report;
+        report.name = name;
+        report.freqs = freqs;
+        report.n_samples = n_samples;
+        report.results_by_freqs.resize(freqs.size());
+        report.phase_locked_errors_by_freqs.resize(freqs.size(), 0.);
+        this->reports.push_back(std::move(report));
+        return this->reports.back();
+    }
+
+    static void print_report(const Report& report) {
+        auto worst_result = worst_analysis_result(report.results_by_freqs);
+
+        if (report.n_samples == 0) {
+            cout << report.name << "\n";
+        } else {
+            cout << report.name << " after " << report.n_samples << " samples\n";
+        }
+        cout << "SNR (db): " << worst_result.worst_snr_record.snr_db << " at " << worst_result.worst_snr_record.freq << " cycles/sample \n"; 
+        cout << "Absolute Gain (db): " << worst_result.worst_abs_gain_record.abs_gain_db << " at " << worst_result.worst_abs_gain_record.freq << " cycles/sample \n"; 
+
+        if (report.n_samples != 0) {
+            auto worst_phase_locked_error_it = max_element(
+                report.phase_locked_errors_by_freqs.cbegin(),
+                report.phase_locked_errors_by_freqs.cend()
+            );
+            auto worst_phase_locked_error_freq = report.freqs[worst_phase_locked_error_it - report.phase_locked_errors_by_freqs.cbegin()];
+            cout << "Phase-Locked Error (db): " << 20 * log10(*worst_phase_locked_error_it) << " at " << worst_phase_locked_error_freq << " cycles/sample \n"; 
+        }
+    }
+
+    public:
+        template<typename OscillatorT>
+        void add_oscillator_analysis(char const* name, const vector<double>& freqs, size_t analysis_len) {
+            Report& report = this->new_report(name, freqs, 0);
+
+            for (size_t i = 0; i < freqs.size(); i++) {
+                double freq = freqs[i];
+                Job job;
+                job.n_samples = analysis_len;
+                job.fn = [&report, i, freq, analysis_len]() {
+                    report.results_by_freqs[i] = frequency_analysis<OscillatorT>(freq, analysis_len);
+                };
+                this->jobs.push_back(std::move(job));
+            }
+        }
+
+        template<typename OscillatorT>
+        void add_long_duration_analysis(char const* name, const vector<double>& freqs, size_t n_samples, size_t analysis_len) {
+            if (analysis_len > n_samples) {
+                std::ostringstream msg;
+                msg << "The analysis length "
+                    << "(analysis_len = " << analysis_len << ") "
+                    << "must not be greater than the number of rendered samples "
+                    << "(n_samples = " << n_samples << ") ";
+                throw invalid_argument(msg.str());
+            }
+
+            Report& report = this->new_report(name, freqs, n_samples);
+
+            for (size_t i = 0; i < freqs.size(); i++) {
+                double freq = freqs[i];
+                Job job;
+                job.n_samples = n_samples;
+                job.fn = [&report, i, freq, n_samples, analysis_len]() {
+                    report.results_by_freqs[i] = long_duration_frequency_analysis<OscillatorT>(
+                        freq, n_samples, analysis_len, report.phase_locked_errors_by_freqs[i]
+                    );
+                };
+                this->jobs.push_back(std::move(job));
+            }
+        }
+
+        void run(size_t n_workers) {
+            std::stable_sort(
+                this->jobs.begin(), 
+                this->jobs.end(), 
+                [](const Job& a, const Job& b){return a.n_samples > b.n_samples;}
+            );
+
+            std::atomic<size_t> next_job_id(0);
+            vector<std::exception_ptr> errors(n_workers);
+
+            auto work = [&](size_t worker_id) {
+                try {
+                    for (
+                        auto job_id = next_job_id.fetch_add(1); 
+                        job_id < this->jobs.size(); 
+                        job_id = next_job_id.fetch_add(1)
+                    ) {
+                        this->jobs[job_id].fn();
+                    }
+                } catch (...) {
+                    errors[worker_id] = std::current_exception();
+                    next_job_id.store(this->jobs.size());
+                }
+            };
+
+            {
+                gfac::WorkerPool pool(n_workers);
+                pool.run(work);
+            }
+
+            for (auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            for (const Report& report : this->reports) {
+                print_report(report);
+            }
+
+            this->jobs.clear();
+            this->reports.clear();
+        }
+    // public
+};
+
+template <class Arch>
+void do_all_accuracy_reports(size_t n_workers) {
+    using float_simd_t = xs::batch<float, Arch>;
+    using double_simd_t = xs::batch<double, Arch>;
+
+    vector<double> freqs(15);
+
+    for(size_t i = 0; i < freqs.size(); i++) {
+        freqs[i] = 0.45 / exp2(double(i));
+    }
+
+    AccuracyHarness<Arch> harness;
+
+    harness.template add_oscillator_analysis<gfac::MagicCircleOscillator<double, double_simd_t, 4>>("Recursive Double-SIMD-4", freqs, 50000);
+
+    harness.template add_oscillator_analysis<gfac::ComplexRotationOscillator<double, double_simd_t, 4>>(
+        "Recursive Complex Rotation Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::ChebyshevOscillator<double, double_simd_t, 4>>(
+        "Recursive Chebyshev Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<float, float_simd_t, 4, FloatCosCalc>>(
+        "Phase-to-Amplitude Float-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, DoubleCosCalc>>(
+        "Phase-to-Amplitude Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, LookupDoubleCosCalc>>(
+        "Phase-to-Amplitude Lookup Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, LinearLookupDoubleCosCalc>>(
+        "Phase-to-Amplitude Linear Lookup Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, CubicLookupDoubleCosCalc>>(
+        "Phase-to-Amplitude Cubic Lookup Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, Linear4096LookupDoubleCosCalc>>(
+        "Phase-to-Amplitude Linear Lookup (4096) Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, Cubic256FloatLookupDoubleCosCalc>>(
+        "Phase-to-Amplitude Cubic Lookup (256 Float) Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, gfac::ApproxCos14Calculator>>(
+        "Phase-to-Amplitude Approx 14-deg Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>(
+        "Phase-to-Amplitude Approx 10-deg Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::CompactSineOscillator<double, double_simd_t, gfac::ApproxCos14Calculator>>(
+        "Phase-to-Amplitude Compact Approx 14-deg Double-SIMD", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, gfac::QuarterWaveCosineCalculator<7>>>(
+        "Phase-to-Amplitude Quarter-Wave 7-deg Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, gfac::QuarterWaveCosineCalculator<9>>>(
+        "Phase-to-Amplitude Quarter-Wave 9-deg Double-SIMD-4", freqs, 50000
+    );
+
+    harness.template add_oscillator_analysis<gfac::SineOscillator<double, double_simd_t, 4, gfac::QuarterWaveCosineCalculator<11>>>(
+        "Phase-to-Amplitude Quarter-Wave 11-deg Double-SIMD-4", freqs, 50000
+    );
+    
+    // One hour at 48 kHz. The analysis window at the end must hold a few periods of the lowest
+    // frequency.
+    vector<double> long_duration_freqs = {0.45, 0.45 / 32., 0.45 / 1024.};
+    size_t long_duration_n_samples = size_t(48000) * 60 * 60;
+    size_t long_duration_analysis_len = 16384;
+
+    harness.template add_long_duration_analysis<gfac::MagicCircleOscillator<double, double_simd_t, 4>>(
+        "Recursive Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::ComplexRotationOscillator<double, double_simd_t, 4>>(
+        "Recursive Complex Rotation Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::ChebyshevOscillator<double, double_simd_t, 4>>(
+        "Recursive Chebyshev Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 256>>(
+        "Recursive (Anchor Every 256 Blocks) Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 16>>(
+        "Recursive (Anchor Every 16 Blocks) Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::CompactSineOscillator<double, double_simd_t, gfac::ApproxCos14Calculator>>(
+        "Phase-to-Amplitude Compact Approx 14-deg Double-SIMD", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.template add_long_duration_analysis<gfac::SineOscillator<double, double_simd_t, 4, gfac::ApproxCos14Calculator>>(
+        "Phase-to-Amplitude Approx 14-deg Double-SIMD-4", long_duration_freqs, long_duration_n_samples, long_duration_analysis_len
+    );
+
+    harness.run(n_workers);
+
+    // harness.template add_oscillator_analysis<gfac::SimpleExactSineOscillator<double>>("Phase-to-Amplitude Simple Double", freqs, 50000);
+}
+
+template <class Arch>
+void AccuracyReports::operator()(Arch, size_t n_workers) const {
+    do_all_accuracy_reports<Arch>(n_workers);
+}
+
+
+#endif
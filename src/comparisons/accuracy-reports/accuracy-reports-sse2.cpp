@@ -0,0 +1,4 @@
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA sse2
+#include "accuracy-reports-impl.hpp"
+
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(, , xsimd::sse2)
\ No newline at end of file
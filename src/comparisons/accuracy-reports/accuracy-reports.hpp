@@ -0,0 +1,50 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_REPORTS_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ACCURACY_REPORTS_HPP
+#include <cstddef>
+#include "xsimd/xsimd.hpp"
+
+/*
+The accuracy reports are compiled once per instruction set (see the accuracy-reports-*.cpp files),
+and main picks the widest instruction set that the CPU supports at runtime with xsimd::dispatch, as
+for the speed benches.
+
+The architectures are listed from the widest to the narrowest, as xsimd::dispatch expects.
+*/
+using accuracy_report_archs = xsimd::arch_list<xsimd::avx512f, xsimd::fma3<xsimd::avx2>, xsimd::sse2>;
+
+/*
+As for the speed benches, the AVX2 and AVX-512 reports are built as shared libraries of their own
+(see CMakeLists.txt), so that the std code that they instantiate is not merged with the baseline
+copies. Their sources define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_MODULE.
+*/
+#if defined(_WIN32)
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_EXPORT __declspec(dllexport)
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_IMPORT __declspec(dllimport)
+#else
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_EXPORT __attribute__((visibility("default")))
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_IMPORT
+#endif
+
+/*
+Analyzes every oscillator over the frequency sweep (and the long duration sweep) on n_workers
+threads, and prints the reports.
+*/
+struct AccuracyReports {
+    template <class Arch>
+    void operator()(Arch, std::size_t n_workers) const;
+};
+
+/*
+Declares (with EXTERN = extern) or defines (with EXTERN empty) the report instantiation for ARCH.
+LINKAGE is empty, or the export or import attribute for the instantiation of a shared library.
+*/
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(EXTERN, LINKAGE, ARCH) \
+    EXTERN template LINKAGE void AccuracyReports::operator()<ARCH>(ARCH, std::size_t) const;
+
+#ifndef GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_MODULE
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(extern, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_IMPORT, xsimd::avx512f)
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(extern, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS_IMPORT, xsimd::fma3<xsimd::avx2>)
+#endif
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ACCURACY_REPORTS(extern, , xsimd::sse2)
+
+#endif
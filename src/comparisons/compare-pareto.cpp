@@ -0,0 +1,21 @@
+#include <iostream>
+#include <cstddef>
+#include <string>
+#include "xsimd/xsimd.hpp"
+#include "speed-benches/speed-benches.hpp"
+
+namespace xs = xsimd;
+
+ 
+// compare-pareto [chunk_size] [n_oscs]
+int main(int argc, char** argv) {
+    std::size_t chunk_size = argc > 1 ? std::stoul(argv[1]) : 1024;
+    std::size_t n_oscs = argc > 2 ? std::stoul(argv[2]) : 256;
+
+    // Like compare-speed, this runs on the widest instruction set the CPU supports.
+    auto pareto_benches = xs::dispatch<speed_bench_archs>(ParetoBenches{});
+
+    pareto_benches(chunk_size, n_oscs);
+  
+    return 0;
+}
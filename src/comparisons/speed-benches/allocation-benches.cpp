@@ -0,0 +1,4 @@
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA sse2
+#include "speed-benches-impl.hpp"
+
+template void AllocationBenches::operator()<xsimd::sse2>(xsimd::sse2, std::size_t, std::size_t) const;
@@ -0,0 +1,28 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include "allocation-counter.hpp"
+
+namespace {
+    std::atomic<std::size_t> heap_allocation_count(0);
+}
+
+std::size_t n_heap_allocations() {
+    return heap_allocation_count.load(std::memory_order_acquire);
+}
+
+// The array and nothrow forms of operator new call this one by default.
+void* operator new(std::size_t size) {
+    heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
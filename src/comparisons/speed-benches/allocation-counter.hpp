@@ -0,0 +1,11 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ALLOCATION_COUNTER_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_ALLOCATION_COUNTER_HPP
+#include <cstddef>
+
+/*
+compare-speed replaces the global operator new (see allocation-counter.cpp) to count the heap
+allocations of every thread, so that the benches can check that the hot paths never allocate.
+*/
+std::size_t n_heap_allocations();
+
+#endif
@@ -0,0 +1,5 @@
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA avx512f
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_MODULE
+#include "speed-benches-impl.hpp"
+
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_EXPORT, xsimd::avx512f)
\ No newline at end of file
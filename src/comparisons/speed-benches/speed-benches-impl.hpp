@@ -0,0 +1,1125 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_SPEED_BENCHES_IMPL_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_SPEED_BENCHES_IMPL_HPP
+
+// Bench definitions. Only include this from a translation unit that is compiled for one
+// instruction set, after defining GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA.
+
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <thread>
+#include <stdexcept>
+#include <fstream>
+#include <string>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+#include "nanobench.h"
+#include "../../implementations/phase-to-amplitude.hpp"
+#include "../../implementations/oscillator-bank.hpp"
+#include "../../implementations/recursive.hpp"
+#include "../../implementations/soa-oscillator-bank.hpp"
+#include "../../implementations/inverse-fft-oscillator-bank.hpp"
+#include "xsimd/xsimd.hpp"
+#include "speed-benches.hpp"
+#include "allocation-counter.hpp"
+#include "../accuracy-analysis/accuracy-analysis.hpp"
+
+namespace xs = xsimd;
+
+namespace gfac = goldenrockefeller::fast_additive_comparison;
+
+using std::cout;
+using std::vector;
+using std::size_t;
+using std::ostringstream;
+
+using gfac::OscillatorBank;
+using gfac::SoaOscillatorBank;
+using gfac::InverseFftOscillatorBank;
+using gfac::SimpleExactSineOscillator;
+using gfac::SineOscillator;
+using gfac::CompactSineOscillator;
+using gfac::PolymorphicOscillator;
+using FloatCosCalc = gfac::ExactCosineCalculator<float>;
+using DoubleCosCalc = gfac::ExactCosineCalculator<double>;
+using LookupDoubleCosCalc = gfac::LookupCalculator<double>;
+using LinearLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::linear>;
+using CubicLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::cubic>;
+using Linear4096LookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::linear, 4096>;
+using Cubic256FloatLookupDoubleCosCalc = gfac::LookupCalculator<double, gfac::LookupInterpolation::cubic, 256, float>;
+using gfac::ApproxCos14Calculator;
+using gfac::ApproxCos10Calculator;
+using gfac::IdentityCalculator;
+using gfac::PolynomialCosineCalculator;
+using gfac::QuarterWaveCosineCalculator;
+
+
+
+
+// The frequencies of the bench oscillators: n_oscs partials evenly spaced from 0 up to the
+// Nyquist frequency (0.5 cycles/sample, excluded).
+template <typename sample_type>
+vector<sample_type> bench_freqs(size_t n_oscs) {
+    vector<sample_type> freqs(n_oscs);
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        freqs[osc_id] = sample_type(osc_id) / sample_type(2 * n_oscs);
+    }
+    return freqs;
+}
+
+template <typename GeneratorT>
+void do_regular_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+
+    bench->run(name, [&]() {
+        for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+            gen.reset_osc(osc_id, freqs[osc_id], 1., 0.);
+        }
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+// Like do_regular_bench, but the oscillators are reset once before the timing, so that the bench
+// only times the rendering.
+template <typename GeneratorT>
+void do_render_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        gen.reset_osc(osc_id, freqs[osc_id], 1., 0.);
+    }
+
+    bench->run(name, [&]() {
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+// Only one oscillator in n_oscs_per_active_osc is audible.
+template <typename GeneratorT>
+void do_sparse_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs, size_t n_oscs_per_active_osc) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        auto ampl = sample_type((osc_id % n_oscs_per_active_osc == 0) ? 1. : 0.);
+        gen.reset_osc(osc_id, freqs[osc_id], ampl, 0.);
+    }
+
+    bench->run(name, [&]() {
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+// Like do_regular_bench, but all the oscillators are reset with one bulk reset.
+template <typename GeneratorT>
+void do_bulk_reset_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+    vector<sample_type> ampls(n_oscs, sample_type(1.));
+    vector<sample_type> phases(n_oscs, sample_type(0.));
+
+    bench->run(name, [&]() {
+        gen.reset_oscs(freqs.data(), ampls.data(), phases.data(), n_oscs);
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+// Like do_regular_bench, but the resets go through the bank's command queue.
+template <typename GeneratorT>
+void do_command_queue_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    gen.enable_command_queue(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+
+    bench->run(name, [&]() {
+        for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+            gen.post_reset_osc(osc_id, freqs[osc_id], 1., 0.);
+        }
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+template <typename OscillatorT>
+void do_quadrature_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename OscillatorT::sample_type;
+
+    vector<OscillatorT> oscs(n_oscs);
+    vector<sample_type> in_phase_output(chunk_size);
+    vector<sample_type> quadrature_output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+
+    bench->run(name, [&]() {
+        for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+            oscs[osc_id].reset(freqs[osc_id], 1., 0.);
+            oscs[osc_id].progress_and_add(in_phase_output.begin(), in_phase_output.end(), quadrature_output.begin());
+        }
+    });
+}
+
+template <typename OscillatorT>
+void do_offset_pair_quadrature_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename OscillatorT::sample_type;
+
+    // Quadrature output the long way: a second oscillator, pi/2 behind the first.
+    vector<OscillatorT> in_phase_oscs(n_oscs);
+    vector<OscillatorT> quadrature_oscs(n_oscs);
+    vector<sample_type> in_phase_output(chunk_size);
+    vector<sample_type> quadrature_output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+
+    bench->run(name, [&]() {
+        for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+            in_phase_oscs[osc_id].reset(freqs[osc_id], 1., 0.);
+            quadrature_oscs[osc_id].reset(freqs[osc_id], 1., -0.5 * gfac::pi<sample_type>());
+            in_phase_oscs[osc_id].progress_and_add(in_phase_output.begin(), in_phase_output.end());
+            quadrature_oscs[osc_id].progress_and_add(quadrature_output.begin(), quadrature_output.end());
+        }
+    });
+}
+
+template <typename GeneratorT>
+void do_parallel_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs, size_t n_threads) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs, n_threads, chunk_size);
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        gen.reset_osc(osc_id, freqs[osc_id], 1., 0.);
+    }
+
+    bench->run(name, [&]() {
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+template <class Arch>
+void do_mixed_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs, size_t n_threads) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    using ExactOsc = SineOscillator<double, double_simd_t, 4, DoubleCosCalc>;
+    using ApproxOsc = SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>;
+
+    // A third of the partials use the exact (expensive) calculator, a third use the approximate
+    // calculator, and a third are silent. The kinds are clustered to unbalance a static split.
+    OscillatorBank<PolymorphicOscillator<double>> gen(n_oscs, n_threads, chunk_size);
+    vector<double> output(chunk_size);
+
+    auto freqs = bench_freqs<double>(n_oscs);
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        auto freq = freqs[osc_id];
+
+        if (3 * osc_id < n_oscs) {
+            gen.osc(osc_id).assign<ExactOsc>(8.);
+            gen.reset_osc(osc_id, freq, 1., 0.);
+        }
+        else if (3 * osc_id < 2 * n_oscs) {
+            gen.osc(osc_id).assign<ApproxOsc>(1.);
+            gen.reset_osc(osc_id, freq, 1., 0.);
+        }
+        else {
+            gen.osc(osc_id).assign<ApproxOsc>(1.);
+            gen.reset_osc(osc_id, freq, 0., 0.);
+        }
+    }
+
+    bench->run(name, [&]() {
+        gen.progress_and_add(output.begin(), output.end());
+    });
+}
+
+template <typename OscillatorT>
+void do_automation_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t control_period, bool use_ramp) {
+    using sample_type = typename OscillatorT::sample_type;
+
+    OscillatorT osc(sample_type(0.01), sample_type(1.), sample_type(0.));
+    vector<sample_type> output(chunk_size);
+
+    bench->run(name, [&]() {
+        for (size_t control_id = 0; control_id * control_period < chunk_size; ++control_id) {
+            auto freq = sample_type(0.01 + 0.0001 * double(control_id % 16));
+            auto ampl = sample_type(1. - 0.01 * double(control_id % 16));
+            auto begin_it = output.begin() + control_id * control_period;
+            auto end_it = output.begin() + std::min((control_id + 1) * control_period, chunk_size);
+
+            if (use_ramp) {
+                osc.ramp(freq, ampl, control_period);
+            }
+            else {
+                osc.reset(freq, ampl, sample_type(0.));
+            }
+            osc.progress_and_add(begin_it, end_it);
+        }
+    });
+}
+
+template <class Arch>
+void do_all_automation_benches(size_t chunk_size, size_t control_period) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] All Automation Bench. Chunck Size: " << chunk_size << "; Control Period: " << control_period;
+    bench.title(title_stream.str());
+
+    bench.minEpochIterations(100);
+
+    do_automation_bench<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>(
+        &bench, "Reset Approx 10-deg Double-SIMD-4", chunk_size, control_period, false
+    );
+
+    do_automation_bench<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>(
+        &bench, "Ramp Approx 10-deg Double-SIMD-4", chunk_size, control_period, true
+    );
+
+    do_automation_bench<gfac::MagicCircleOscillator<double, double_simd_t, 4>>(
+        &bench, "Reset Recursive Double-SIMD-4", chunk_size, control_period, false
+    );
+
+    do_automation_bench<gfac::MagicCircleOscillator<double, double_simd_t, 4>>(
+        &bench, "Ramp Recursive Double-SIMD-4", chunk_size, control_period, true
+    );
+
+    do_automation_bench<gfac::ComplexRotationOscillator<double, double_simd_t, 4>>(
+        &bench, "Reset Recursive Complex Rotation Double-SIMD-4", chunk_size, control_period, false
+    );
+
+    do_automation_bench<gfac::ChebyshevOscillator<double, double_simd_t, 4>>(
+        &bench, "Reset Recursive Chebyshev Double-SIMD-4", chunk_size, control_period, false
+    );
+}
+
+template <class Arch>
+void do_all_regular_benches(size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] All Regular Bench. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs;
+    bench.title(title_stream.str());
+
+    bench.minEpochIterations(100);
+
+    do_regular_bench<OscillatorBank<SimpleExactSineOscillator<double>>>(
+        &bench, "Phase-to-Amplitude Simple Double", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double, 1,DoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Exact Double-1", chunk_size, n_oscs
+    );
+
+     do_regular_bench<OscillatorBank<SineOscillator<double, double, 4,DoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Exact Double-4", chunk_size, n_oscs
+    );
+
+     do_regular_bench<OscillatorBank<SineOscillator<double, double, 16,DoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Exact Double-16", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, IdentityCalculator>>>(
+        &bench, "Phase-to-Amplitude Identity Double-SIMD-4", chunk_size, n_oscs
+    );
+
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 1,DoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Exact Double-SIMD-1", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4,DoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Exact Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double, 1, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-1", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double, 16, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-16", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 1, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-1", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos14Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 14-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4,LookupDoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Lookup Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, LinearLookupDoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Linear Lookup Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, CubicLookupDoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Cubic Lookup Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, Linear4096LookupDoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Linear Lookup (4096) Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, Cubic256FloatLookupDoubleCosCalc>>>(
+        &bench, "Phase-to-Amplitude Cubic Lookup (256 Float) Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Compact Approx 10-deg Double-SIMD", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4>>>(
+        &bench, "Recursive Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::ComplexRotationOscillator<double, double_simd_t, 4>>>(
+        &bench, "Recursive Complex Rotation Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::ChebyshevOscillator<double, double_simd_t, 4>>>(
+        &bench, "Recursive Chebyshev Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 16>>>(
+        &bench, "Recursive (Anchor Every 16 Blocks) Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 256>>>(
+        &bench, "Recursive (Anchor Every 256 Blocks) Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator, std::allocator<double>>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4 (Unaligned Blocks)", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 16, ApproxCos10Calculator, std::allocator<double>>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-16 (Unaligned Blocks)", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 16, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-16", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4, std::allocator<double>>>>(
+        &bench, "Recursive Double-SIMD-4 (Unaligned Blocks)", chunk_size, n_oscs
+    );
+
+    do_regular_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator>>(
+        &bench, "SoA Bank Approx 10-deg Double-SIMD", chunk_size, n_oscs
+    );
+
+    // The AoS bank's bulk reset still resets every oscillator on its own; it only saves the
+    // per-call bounds checks. Only the SoA bank's bulk reset vectorizes across oscillators.
+    do_bulk_reset_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4 (Bulk Reset, Bounds Checks Only)", chunk_size, n_oscs
+    );
+
+    do_bulk_reset_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator>>(
+        &bench, "SoA Bank Approx 10-deg Double-SIMD (Vectorized Bulk Reset)", chunk_size, n_oscs
+    );
+
+    do_command_queue_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4 (Command Queue)", chunk_size, n_oscs
+    );
+
+    do_sparse_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4 (1 in 8 Active, x8 Oscs)", chunk_size, 8 * n_oscs, 8
+    );
+
+    do_regular_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos14Calculator>>(
+        &bench, "SoA Bank Approx 14-deg Double-SIMD", chunk_size, n_oscs
+    );
+    
+}
+ 
+
+
+
+template <class Arch>
+void do_all_parallel_benches(size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    using Osc = SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>;
+    using ArenaOsc = SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator, gfac::ArenaAllocator<double, 64>>;
+    using ArenaRecursiveOsc = gfac::MagicCircleOscillator<double, double_simd_t, 4, gfac::ArenaAllocator<double, 64>>;
+
+    ankerl::nanobench::Bench bench;
+
+    size_t n_threads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] All Parallel Bench. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs << "; Num of Threads: " << n_threads;
+    bench.title(title_stream.str());
+
+    bench.minEpochIterations(10);
+
+    do_parallel_bench<OscillatorBank<Osc>>(
+        &bench, "Serial Approx 10-deg Double-SIMD-4", chunk_size, n_oscs, 1
+    );
+
+    do_parallel_bench<OscillatorBank<Osc>>(
+        &bench, "Parallel Approx 10-deg Double-SIMD-4", chunk_size, n_oscs, n_threads
+    );
+
+    do_parallel_bench<OscillatorBank<ArenaOsc>>(
+        &bench, "Serial Arena Approx 10-deg Double-SIMD-4", chunk_size, n_oscs, 1
+    );
+
+    do_parallel_bench<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4>>>(
+        &bench, "Serial Recursive Double-SIMD-4", chunk_size, n_oscs, 1
+    );
+
+    do_parallel_bench<OscillatorBank<ArenaRecursiveOsc>>(
+        &bench, "Serial Arena Recursive Double-SIMD-4", chunk_size, n_oscs, 1
+    );
+
+    do_mixed_bench<Arch>(&bench, "Serial Mixed Double-SIMD-4", chunk_size, n_oscs, 1);
+
+    do_mixed_bench<Arch>(&bench, "Parallel Mixed Double-SIMD-4", chunk_size, n_oscs, n_threads);
+}
+
+template <class Arch, std::size_t DEGREE>
+void do_polynomial_benches(ankerl::nanobench::Bench* bench, size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+    using gfac::PolynomialScheme;
+
+    ostringstream name_stream;
+
+    name_stream.str("");
+    name_stream << "Phase-to-Amplitude Horner " << DEGREE << "-deg Double-SIMD-4";
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, PolynomialCosineCalculator<DEGREE, PolynomialScheme::horner>>>>(
+        bench, name_stream.str().c_str(), chunk_size, n_oscs
+    );
+
+    name_stream.str("");
+    name_stream << "Phase-to-Amplitude Estrin " << DEGREE << "-deg Double-SIMD-4";
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, PolynomialCosineCalculator<DEGREE, PolynomialScheme::estrin>>>>(
+        bench, name_stream.str().c_str(), chunk_size, n_oscs
+    );
+
+    name_stream.str("");
+    name_stream << "Phase-to-Amplitude Fused Horner " << DEGREE << "-deg Double-SIMD-4";
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, PolynomialCosineCalculator<DEGREE, PolynomialScheme::fused_horner>>>>(
+        bench, name_stream.str().c_str(), chunk_size, n_oscs
+    );
+
+    name_stream.str("");
+    name_stream << "Phase-to-Amplitude Fused Estrin " << DEGREE << "-deg Double-SIMD-4";
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, PolynomialCosineCalculator<DEGREE, PolynomialScheme::fused_estrin>>>>(
+        bench, name_stream.str().c_str(), chunk_size, n_oscs
+    );
+}
+
+template <class Arch>
+void do_all_polynomial_benches(size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] All Polynomial Bench. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs;
+    bench.title(title_stream.str());
+
+    bench.minEpochIterations(100);
+
+    do_polynomial_benches<Arch, 6>(&bench, chunk_size, n_oscs);
+    do_polynomial_benches<Arch, 8>(&bench, chunk_size, n_oscs);
+    do_polynomial_benches<Arch, 10>(&bench, chunk_size, n_oscs);
+    do_polynomial_benches<Arch, 12>(&bench, chunk_size, n_oscs);
+    do_polynomial_benches<Arch, 14>(&bench, chunk_size, n_oscs);
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<5>>>>(
+        &bench, "Phase-to-Amplitude Quarter-Wave Fused Estrin 5-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<7>>>>(
+        &bench, "Phase-to-Amplitude Quarter-Wave Fused Estrin 7-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<9>>>>(
+        &bench, "Phase-to-Amplitude Quarter-Wave Fused Estrin 9-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<11>>>>(
+        &bench, "Phase-to-Amplitude Quarter-Wave Fused Estrin 11-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_offset_pair_quadrature_bench<SineOscillator<double, double_simd_t, 4, PolynomialCosineCalculator<14>>>(
+        &bench, "Quadrature by Offset Pair Fused Estrin 14-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_quadrature_bench<gfac::QuadratureSineOscillator<double, double_simd_t, 4, gfac::PolynomialSinCosCalculator<14>>>(
+        &bench, "Quadrature by SinCos Fused Estrin 14-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+}
+
+// One cell of the bench matrix. The bench reports its rendering time (without the resets) per
+// sample per oscillator.
+template <typename GeneratorT>
+void do_matrix_bench(ankerl::nanobench::Bench* bench, char const* implementation, size_t n_operands_per_block, size_t chunk_size, size_t n_oscs) {
+    ostringstream name_stream;
+    name_stream << implementation 
+        << "; Operands per Block: " << n_operands_per_block 
+        << "; Chunk Size: " << chunk_size 
+        << "; Num of Oscs: " << n_oscs;
+
+    bench->batch(chunk_size * n_oscs);
+    do_render_bench<GeneratorT>(bench, name_stream.str().c_str(), chunk_size, n_oscs);
+}
+
+template <class Arch, size_t N_OPERANDS_PER_BLOCK>
+void do_block_matrix_benches(ankerl::nanobench::Bench* bench, size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    do_matrix_bench<OscillatorBank<SineOscillator<double, double_simd_t, N_OPERANDS_PER_BLOCK, ApproxCos10Calculator>>>(
+        bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD", N_OPERANDS_PER_BLOCK, chunk_size, n_oscs
+    );
+
+    do_matrix_bench<OscillatorBank<SineOscillator<double, double_simd_t, N_OPERANDS_PER_BLOCK, CubicLookupDoubleCosCalc>>>(
+        bench, "Phase-to-Amplitude Cubic Lookup Double-SIMD", N_OPERANDS_PER_BLOCK, chunk_size, n_oscs
+    );
+
+    do_matrix_bench<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, N_OPERANDS_PER_BLOCK>>>(
+        bench, "Recursive Double-SIMD", N_OPERANDS_PER_BLOCK, chunk_size, n_oscs
+    );
+
+    do_matrix_bench<OscillatorBank<gfac::ComplexRotationOscillator<double, double_simd_t, N_OPERANDS_PER_BLOCK>>>(
+        bench, "Recursive Complex Rotation Double-SIMD", N_OPERANDS_PER_BLOCK, chunk_size, n_oscs
+    );
+}
+
+template <class Arch>
+void do_all_matrix_benches(const size_t* chunk_sizes, size_t chunk_sizes_len, const size_t* n_oscs_list, size_t n_oscs_list_len, const std::string& output_prefix) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] Matrix Bench";
+    bench.title(title_stream.str());
+    bench.unit("sample-osc");
+
+    for (auto chunk_size_it = chunk_sizes; chunk_size_it < chunk_sizes + chunk_sizes_len; ++chunk_size_it) {
+        for (auto n_oscs_it = n_oscs_list; n_oscs_it < n_oscs_list + n_oscs_list_len; ++n_oscs_it) {
+            auto chunk_size = *chunk_size_it;
+            auto n_oscs = *n_oscs_it;
+
+            do_block_matrix_benches<Arch, 1>(&bench, chunk_size, n_oscs);
+            do_block_matrix_benches<Arch, 2>(&bench, chunk_size, n_oscs);
+            do_block_matrix_benches<Arch, 4>(&bench, chunk_size, n_oscs);
+            do_block_matrix_benches<Arch, 8>(&bench, chunk_size, n_oscs);
+            do_block_matrix_benches<Arch, 16>(&bench, chunk_size, n_oscs);
+
+            // These implementations have no blocks.
+            do_matrix_bench<OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos10Calculator>>>(
+                &bench, "Phase-to-Amplitude Compact Approx 10-deg Double-SIMD", 0, chunk_size, n_oscs
+            );
+
+            do_matrix_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator>>(
+                &bench, "SoA Bank Approx 10-deg Double-SIMD", 0, chunk_size, n_oscs
+            );
+
+            do_matrix_bench<InverseFftOscillatorBank<double, 1024>>(
+                &bench, "Inverse-FFT 1024 Double", 0, chunk_size, n_oscs
+            );
+        }
+    }
+
+    std::ofstream json_file(output_prefix + ".json");
+    ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, json_file);
+
+    std::ofstream csv_file(output_prefix + ".csv");
+    ankerl::nanobench::render(ankerl::nanobench::templates::csv(), bench, csv_file);
+
+    cout << "Matrix bench results written to " << output_prefix << ".json and " << output_prefix << ".csv\n";
+}
+
+/*
+Render a bank of the harmonics of 1 / n_oscs cycles/sample, with amplitudes falling as 1 / harmonic,
+so that the upper half of the partials is at or above the Nyquist frequency. With use_culling, the
+bank culls them with set_culling. Returns the number of culled oscillators.
+*/
+template <typename GeneratorT>
+size_t do_culling_bench(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs, bool use_culling) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    GeneratorT gen(n_oscs);
+    vector<sample_type> output(chunk_size);
+
+    if (use_culling) {
+        gen.set_culling(sample_type(0.5), sample_type(0.));
+    }
+
+    for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+        auto harmonic = sample_type(osc_id + 1);
+        gen.reset_osc(osc_id, harmonic / sample_type(n_oscs), sample_type(1.) / harmonic, 0.);
+    }
+
+    bench->run(name, [&]() {
+        gen.progress_and_add(output.begin(), output.end());
+    });
+
+    return gen.n_culled_oscs();
+}
+
+// Times do_culling_bench with culling off and on, and prints the number of culled oscillators and
+// both times per sample.
+template <typename GeneratorT>
+void do_culling_comparison(ankerl::nanobench::Bench* bench, char const* name, size_t chunk_size, size_t n_oscs) {
+    ostringstream name_stream;
+
+    name_stream << name << " (Culling Off)";
+    do_culling_bench<GeneratorT>(bench, name_stream.str().c_str(), chunk_size, n_oscs, false);
+    auto ns_per_sample_without_culling = (
+        1e9 * bench->results().back().median(ankerl::nanobench::Result::Measure::elapsed) / double(chunk_size)
+    );
+
+    name_stream.str("");
+    name_stream << name << " (Culling On)";
+    auto n_culled_oscs = do_culling_bench<GeneratorT>(bench, name_stream.str().c_str(), chunk_size, n_oscs, true);
+    auto ns_per_sample_with_culling = (
+        1e9 * bench->results().back().median(ankerl::nanobench::Result::Measure::elapsed) / double(chunk_size)
+    );
+
+    cout << name << ": " << n_culled_oscs << " of " << n_oscs << " oscillators culled; " 
+        << ns_per_sample_without_culling << " ns/sample with culling off, " 
+        << ns_per_sample_with_culling << " ns/sample with culling on\n";
+}
+
+template <class Arch>
+void do_all_culling_benches(size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] Culling Bench. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs;
+    bench.title(title_stream.str());
+    bench.batch(chunk_size);
+    bench.unit("sample");
+    bench.minEpochIterations(100);
+
+    do_culling_comparison<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4", chunk_size, n_oscs
+    );
+
+    do_culling_comparison<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4>>>(
+        &bench, "Recursive Double-SIMD-4", chunk_size, n_oscs
+    );
+}
+
+/*
+Count the heap allocations made by n_chunks resets and renders of a generator, after one warm-up
+reset and render, and throw if there are any.
+*/
+template <typename GeneratorT>
+void do_allocation_check(char const* name, GeneratorT& gen, size_t chunk_size, size_t n_oscs) {
+    using sample_type = typename GeneratorT::sample_type;
+
+    const size_t n_chunks = 16;
+
+    vector<sample_type> output(chunk_size);
+
+    auto freqs = bench_freqs<sample_type>(n_oscs);
+    vector<sample_type> ampls(n_oscs, sample_type(1.));
+    vector<sample_type> phases(n_oscs, sample_type(0.));
+
+    gen.reset_oscs(freqs.data(), ampls.data(), phases.data(), n_oscs);
+    gen.progress_and_add(output.begin(), output.end());
+
+    auto n_allocations_before = n_heap_allocations();
+
+    for (size_t chunk_id = 0; chunk_id < n_chunks; chunk_id++) {
+        for (size_t osc_id = 0; osc_id < n_oscs; ++osc_id) {
+            gen.reset_osc(osc_id, freqs[osc_id], ampls[osc_id], phases[osc_id]);
+        }
+        gen.progress_and_add(output.begin(), output.end());
+        gen.reset_oscs(freqs.data(), ampls.data(), phases.data(), n_oscs);
+        gen.progress_and_add(output.begin(), output.end());
+    }
+
+    auto n_allocations = n_heap_allocations() - n_allocations_before;
+
+    cout << name << ": " << n_allocations << " heap allocations\n";
+
+    if (n_allocations != 0) {
+        ostringstream msg;
+        msg << name << " must not allocate when resetting or rendering "
+            << "(n_allocations = " << n_allocations << ") ";
+        throw std::runtime_error(msg.str());
+    }
+}
+
+template <class Arch>
+void do_all_allocation_checks(size_t chunk_size, size_t n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    cout << "[" << Arch::name() << "] Allocation Check. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs << "\n";
+
+    OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>> sine_bank(n_oscs);
+    do_allocation_check("Phase-to-Amplitude Approx 10-deg Double-SIMD-4", sine_bank, chunk_size, n_oscs);
+
+    OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos10Calculator>> compact_sine_bank(n_oscs);
+    do_allocation_check("Phase-to-Amplitude Compact Approx 10-deg Double-SIMD", compact_sine_bank, chunk_size, n_oscs);
+
+    OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4>> recursive_bank(n_oscs);
+    do_allocation_check("Recursive Double-SIMD-4", recursive_bank, chunk_size, n_oscs);
+
+    OscillatorBank<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 16>> anchored_recursive_bank(n_oscs);
+    do_allocation_check("Recursive (Anchor Every 16 Blocks) Double-SIMD-4", anchored_recursive_bank, chunk_size, n_oscs);
+
+    OscillatorBank<gfac::ComplexRotationOscillator<double, double_simd_t, 4>> rotation_bank(n_oscs);
+    do_allocation_check("Recursive Complex Rotation Double-SIMD-4", rotation_bank, chunk_size, n_oscs);
+
+    OscillatorBank<gfac::ChebyshevOscillator<double, double_simd_t, 4>> chebyshev_bank(n_oscs);
+    do_allocation_check("Recursive Chebyshev Double-SIMD-4", chebyshev_bank, chunk_size, n_oscs);
+
+    OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4, gfac::ArenaAllocator<double, 64>>> arena_recursive_bank(n_oscs);
+    do_allocation_check("Recursive Double-SIMD-4 (Arena)", arena_recursive_bank, chunk_size, n_oscs);
+
+    OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>> parallel_sine_bank(n_oscs, 4, chunk_size);
+    do_allocation_check("Phase-to-Amplitude Approx 10-deg Double-SIMD-4 (4 Threads)", parallel_sine_bank, chunk_size, n_oscs);
+
+    SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator> soa_bank(n_oscs);
+    do_allocation_check("SoA Bank Approx 10-deg Double-SIMD", soa_bank, chunk_size, n_oscs);
+
+    InverseFftOscillatorBank<double> inverse_fft_bank(n_oscs);
+    do_allocation_check("Inverse-FFT 1024 Double", inverse_fft_bank, chunk_size, n_oscs);
+}
+
+/*
+Time-domain banks against the inverse-FFT bank, for a growing number of partials, to find where
+the inverse-FFT bank's fixed cost per sample pays off.
+*/
+template <class Arch>
+void do_all_crossover_benches(size_t chunk_size, size_t max_n_oscs) {
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] Inverse-FFT Crossover Bench. Chunck Size: " << chunk_size;
+    bench.title(title_stream.str());
+
+    for (size_t n_oscs = 16; n_oscs <= max_n_oscs; n_oscs *= 4) {
+        ostringstream name_stream;
+
+        name_stream << "Phase-to-Amplitude Approx 10-deg Double-SIMD-4; Num of Oscs: " << n_oscs;
+        do_regular_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+            &bench, name_stream.str().c_str(), chunk_size, n_oscs
+        );
+
+        name_stream.str("");
+        name_stream << "Phase-to-Amplitude Compact Approx 10-deg Double-SIMD; Num of Oscs: " << n_oscs;
+        do_regular_bench<OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos10Calculator>>>(
+            &bench, name_stream.str().c_str(), chunk_size, n_oscs
+        );
+
+        name_stream.str("");
+        name_stream << "SoA Bank Approx 10-deg Double-SIMD; Num of Oscs: " << n_oscs;
+        do_regular_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator>>(
+            &bench, name_stream.str().c_str(), chunk_size, n_oscs
+        );
+
+        name_stream.str("");
+        name_stream << "Inverse-FFT 1024 Double; Num of Oscs: " << n_oscs;
+        do_regular_bench<InverseFftOscillatorBank<double, 1024>>(
+            &bench, name_stream.str().c_str(), chunk_size, n_oscs
+        );
+
+        name_stream.str("");
+        name_stream << "Inverse-FFT 4096 Double; Num of Oscs: " << n_oscs;
+        do_regular_bench<InverseFftOscillatorBank<double, 4096>>(
+            &bench, name_stream.str().c_str(), chunk_size, n_oscs
+        );
+    }
+}
+
+struct ParetoRecord {
+    std::string name;
+    double ns_per_sample_per_osc;
+    double worst_snr_db;
+    double worst_abs_gain_db;
+};
+
+/*
+Time the rendering of GeneratorT with do_render_bench, then run the accuracy analysis on a bank
+of one of its oscillators (see gfac::BankOscillator for N_SETTLING_SAMPLES).
+*/
+template <typename GeneratorT, size_t N_SETTLING_SAMPLES = 0>
+void do_pareto_bench(
+    ankerl::nanobench::Bench* bench, 
+    vector<ParetoRecord>* records, 
+    char const* name, 
+    size_t chunk_size, 
+    size_t n_oscs, 
+    const vector<double>& freqs, 
+    size_t analysis_len
+) {
+    bench->batch(chunk_size * n_oscs);
+    do_render_bench<GeneratorT>(bench, name, chunk_size, n_oscs);
+
+    ParetoRecord record;
+    record.name = name;
+    record.ns_per_sample_per_osc = (
+        1e9 * bench->results().back().median(ankerl::nanobench::Result::Measure::elapsed) 
+        / double(chunk_size * n_oscs)
+    );
+    auto accuracy = gfac::oscillator_analysis<gfac::BankOscillator<GeneratorT, N_SETTLING_SAMPLES>>(freqs, analysis_len);
+    record.worst_snr_db = accuracy.worst_snr_record.snr_db;
+    record.worst_abs_gain_db = accuracy.worst_abs_gain_record.abs_gain_db;
+    records->push_back(record);
+}
+
+/*
+Print all the records, fastest first, and mark the Pareto frontier: the records that are more
+accurate (by worst SNR) than every faster record. Records that are equally fast go from the most
+to the least accurate, so only the most accurate of them can be on the frontier.
+*/
+template <class Arch>
+void print_pareto_report(char const* title, vector<ParetoRecord> records) {
+    std::stable_sort(
+        records.begin(), 
+        records.end(), 
+        [](const ParetoRecord& a, const ParetoRecord& b){
+            if (a.ns_per_sample_per_osc != b.ns_per_sample_per_osc) {
+                return a.ns_per_sample_per_osc < b.ns_per_sample_per_osc;
+            }
+            return a.worst_snr_db > b.worst_snr_db;
+        }
+    );
+
+    vector<bool> is_on_frontier(records.size(), false);
+    double best_snr_db = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < records.size(); i++) {
+        if (records[i].worst_snr_db > best_snr_db) {
+            best_snr_db = records[i].worst_snr_db;
+            is_on_frontier[i] = true;
+        }
+    }
+
+    cout << "\n" << title << "\n\n";
+    cout 
+        << std::setw(16) << "ns/sample/osc" 
+        << std::setw(12) << "SNR (db)" 
+        << std::setw(20) << "Absolute Gain (db)" 
+        << std::setw(10) << "Pareto" 
+        << "  Implementation\n";
+
+    for (size_t i = 0; i < records.size(); i++) {
+        cout 
+            << std::fixed << std::setprecision(3) << std::setw(16) << records[i].ns_per_sample_per_osc
+            << std::setprecision(1) << std::setw(12) << records[i].worst_snr_db
+            << std::scientific << std::setprecision(2) << std::setw(20) << records[i].worst_abs_gain_db
+            << std::setw(10) << (is_on_frontier[i] ? "*" : "")
+            << "  " << records[i].name << "\n";
+    }
+    cout << std::defaultfloat;
+
+    cout << "\nPareto frontier (the fastest implementation for each quality budget):\n";
+    for (size_t i = 0; i < records.size(); i++) {
+        if (is_on_frontier[i]) {
+            cout 
+                << "  SNR >= " << std::fixed << std::setprecision(1) << records[i].worst_snr_db << " db: "
+                << records[i].name << " (" << std::setprecision(3) << records[i].ns_per_sample_per_osc << " ns/sample/osc)\n";
+        }
+    }
+    cout << std::defaultfloat;
+}
+
+template <class Arch>
+void do_all_pareto_benches(size_t chunk_size, size_t n_oscs) {
+    using float_simd_t = xs::batch<float, Arch>;
+    using double_simd_t = xs::batch<double, Arch>;
+
+    ankerl::nanobench::Bench bench;
+
+    ostringstream title_stream;
+    title_stream << "[" << Arch::name() << "] Pareto Bench. Chunck Size: " << chunk_size << "; Num of Oscs: " << n_oscs;
+    bench.title(title_stream.str());
+    bench.unit("sample-osc");
+
+    // The same sweep as compare-accuracy.
+    vector<double> freqs(15);
+    for (size_t i = 0; i < freqs.size(); i++) {
+        freqs[i] = 0.45 / std::exp2(double(i));
+    }
+    size_t analysis_len = 50000;
+
+    vector<ParetoRecord> records;
+
+    do_pareto_bench<OscillatorBank<SineOscillator<float, float_simd_t, 4, FloatCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Exact Float-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, DoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Exact Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos10Calculator>>>(
+        &bench, &records, "Phase-to-Amplitude Approx 10-deg Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, ApproxCos14Calculator>>>(
+        &bench, &records, "Phase-to-Amplitude Approx 14-deg Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<7>>>>(
+        &bench, &records, "Phase-to-Amplitude Quarter-Wave 7-deg Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<9>>>>(
+        &bench, &records, "Phase-to-Amplitude Quarter-Wave 9-deg Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, QuarterWaveCosineCalculator<11>>>>(
+        &bench, &records, "Phase-to-Amplitude Quarter-Wave 11-deg Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, LookupDoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Lookup Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, LinearLookupDoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Linear Lookup Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, CubicLookupDoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Cubic Lookup Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, Linear4096LookupDoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Linear Lookup (4096) Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<SineOscillator<double, double_simd_t, 4, Cubic256FloatLookupDoubleCosCalc>>>(
+        &bench, &records, "Phase-to-Amplitude Cubic Lookup (256 Float) Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos10Calculator>>>(
+        &bench, &records, "Phase-to-Amplitude Compact Approx 10-deg Double-SIMD", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<CompactSineOscillator<double, double_simd_t, ApproxCos14Calculator>>>(
+        &bench, &records, "Phase-to-Amplitude Compact Approx 14-deg Double-SIMD", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<gfac::MagicCircleOscillator<double, double_simd_t, 4>>>(
+        &bench, &records, "Recursive Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<gfac::ComplexRotationOscillator<double, double_simd_t, 4>>>(
+        &bench, &records, "Recursive Complex Rotation Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<gfac::ChebyshevOscillator<double, double_simd_t, 4>>>(
+        &bench, &records, "Recursive Chebyshev Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<OscillatorBank<gfac::AnchoredMagicCircleOscillator<double, double_simd_t, 4, 16>>>(
+        &bench, &records, "Recursive (Anchor Every 16 Blocks) Double-SIMD-4", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos10Calculator>>(
+        &bench, &records, "SoA Bank Approx 10-deg Double-SIMD", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    do_pareto_bench<SoaOscillatorBank<double, double_simd_t, ApproxCos14Calculator>>(
+        &bench, &records, "SoA Bank Approx 14-deg Double-SIMD", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    // The inverse-FFT bank cross-fades its resets over one FFT.
+    do_pareto_bench<InverseFftOscillatorBank<double, 1024>, 1024>(
+        &bench, &records, "Inverse-FFT 1024 Double", chunk_size, n_oscs, freqs, analysis_len
+    );
+
+    print_pareto_report<Arch>(title_stream.str().c_str(), records);
+}
+
+template <class Arch>
+void RegularBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_regular_benches<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void ParallelBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_parallel_benches<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void AutomationBenches::operator()(Arch, size_t chunk_size, size_t control_period) const {
+    do_all_automation_benches<Arch>(chunk_size, control_period);
+}
+
+template <class Arch>
+void PolynomialBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_polynomial_benches<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void AllocationBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_allocation_checks<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void MatrixBenches::operator()(
+    Arch, 
+    const size_t* chunk_sizes, 
+    size_t chunk_sizes_len, 
+    const size_t* n_oscs_list, 
+    size_t n_oscs_list_len, 
+    const char* output_prefix
+) const {
+    do_all_matrix_benches<Arch>(chunk_sizes, chunk_sizes_len, n_oscs_list, n_oscs_list_len, output_prefix);
+}
+
+template <class Arch>
+void ParetoBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_pareto_benches<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void CullingBenches::operator()(Arch, size_t chunk_size, size_t n_oscs) const {
+    do_all_culling_benches<Arch>(chunk_size, n_oscs);
+}
+
+template <class Arch>
+void CrossoverBenches::operator()(Arch, size_t chunk_size, size_t max_n_oscs) const {
+    do_all_crossover_benches<Arch>(chunk_size, max_n_oscs);
+}
+
+#endif
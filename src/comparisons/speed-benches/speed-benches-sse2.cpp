@@ -0,0 +1,4 @@
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA sse2
+#include "speed-benches-impl.hpp"
+
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(, , xsimd::sse2)
\ No newline at end of file
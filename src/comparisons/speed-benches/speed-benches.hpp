@@ -0,0 +1,126 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_SPEED_BENCHES_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_COMPARISONS_SPEED_BENCHES_HPP
+#include <cstddef>
+#include "xsimd/xsimd.hpp"
+
+/*
+The speed benches are compiled once per instruction set (see the speed-benches-*.cpp files), and
+main picks the widest instruction set that the CPU supports at runtime with xsimd::dispatch.
+
+The architectures are listed from the widest to the narrowest, as xsimd::dispatch expects.
+*/
+using speed_bench_archs = xsimd::arch_list<xsimd::avx512f, xsimd::fma3<xsimd::avx2>, xsimd::sse2>;
+
+/*
+The AVX2 and AVX-512 benches are built as shared libraries of their own (see CMakeLists.txt), which
+are only loaded once main picks them. Linked into main, the std and nanobench code that they
+instantiate would be merged with the baseline copies, and the linker could keep the copy built
+for the wider instruction set. Only the bench instantiations below cross the library boundary,
+and they only take plain values and pointers.
+
+The sources of those libraries define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_MODULE.
+*/
+#if defined(_WIN32)
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_EXPORT __declspec(dllexport)
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_IMPORT __declspec(dllimport)
+#else
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_EXPORT __attribute__((visibility("default")))
+    #define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_IMPORT
+#endif
+
+struct RegularBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+struct ParallelBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+struct AutomationBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t control_period) const;
+};
+
+struct PolynomialBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+struct CrossoverBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t max_n_oscs) const;
+};
+
+/*
+Renders banks whose upper half of partials is at or above the Nyquist frequency, with culling off
+and on (see OscillatorBank::set_culling), and prints the number of culled oscillators and the
+time per sample of both.
+*/
+struct CullingBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+/*
+Not a timing bench: checks that resetting and rendering never allocate on the heap, and throws if
+they do. The allocations do not depend on the instruction set, so the check is only built for the
+baseline one (see allocation-benches.cpp), into compare-speed, which counts the heap allocations.
+*/
+struct AllocationBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+/*
+Sweeps chunk size (from the chunk_sizes_len values at chunk_sizes) x number of oscillators (from
+the n_oscs_list_len values at n_oscs_list) x operands per block x implementation, and writes the
+results (per sample per oscillator) to output_prefix + ".json" and output_prefix + ".csv" with
+nanobench's render templates.
+*/
+struct MatrixBenches {
+    template <class Arch>
+    void operator()(
+        Arch, 
+        const std::size_t* chunk_sizes, 
+        std::size_t chunk_sizes_len, 
+        const std::size_t* n_oscs_list, 
+        std::size_t n_oscs_list_len, 
+        const char* output_prefix
+    ) const;
+};
+
+/*
+Times every oscillator configuration (per sample per oscillator), analyzes its worst SNR and gain
+over the compare-accuracy frequency sweep, and prints both in one table with the Pareto frontier
+of time against SNR.
+*/
+struct ParetoBenches {
+    template <class Arch>
+    void operator()(Arch, std::size_t chunk_size, std::size_t n_oscs) const;
+};
+
+/*
+Declares (with EXTERN = extern) or defines (with EXTERN empty) the bench instantiations for ARCH.
+LINKAGE is empty, or the export or import attribute for the instantiations of a shared library.
+*/
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(EXTERN, LINKAGE, ARCH) \
+    EXTERN template LINKAGE void RegularBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void ParallelBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void AutomationBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void PolynomialBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void CrossoverBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void CullingBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const; \
+    EXTERN template LINKAGE void MatrixBenches::operator()<ARCH>(ARCH, const std::size_t*, std::size_t, const std::size_t*, std::size_t, const char*) const; \
+    EXTERN template LINKAGE void ParetoBenches::operator()<ARCH>(ARCH, std::size_t, std::size_t) const;
+
+#ifndef GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_MODULE
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(extern, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_IMPORT, xsimd::avx512f)
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(extern, GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES_IMPORT, xsimd::fma3<xsimd::avx2>)
+#endif
+GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_SPEED_BENCHES(extern, , xsimd::sse2)
+
+extern template void AllocationBenches::operator()<xsimd::sse2>(xsimd::sse2, std::size_t, std::size_t) const;
+
+#endif
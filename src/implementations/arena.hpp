@@ -0,0 +1,122 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_ARENA_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_ARENA_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <new>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    One preallocated, cache-line-aligned slab that oscillator blocks are carved from.
+
+    Allocation bumps an offset; deallocation does nothing, and the whole slab is released with
+    the arena. An arena that runs out of space throws std::bad_alloc.
+    */
+    class OscillatorArena {
+        using size_t = std::size_t;
+
+        std::vector<char, AlignedAllocator<char, cache_line_size()>> slab;
+        size_t n_used_bytes;
+
+        public:
+            OscillatorArena(size_t n_bytes) : slab(n_bytes), n_used_bytes(0) {}
+
+            OscillatorArena(const OscillatorArena&) = delete;
+            OscillatorArena& operator=(const OscillatorArena&) = delete;
+
+            void* allocate(size_t n_bytes, size_t alignment) {
+                auto slab_address = reinterpret_cast<std::uintptr_t>(this->slab.data());
+                auto address = (slab_address + this->n_used_bytes + alignment - 1) & ~std::uintptr_t(alignment - 1);
+                auto new_n_used_bytes = size_t(address - slab_address) + n_bytes;
+
+                if (new_n_used_bytes > this->slab.size()) {
+                    throw std::bad_alloc();
+                }
+
+                this->n_used_bytes = new_n_used_bytes;
+                return reinterpret_cast<void*>(address);
+            }
+
+            size_t n_bytes() const {
+                return this->slab.size();
+            }
+
+            size_t n_used() const {
+                return this->n_used_bytes;
+            }
+        // public
+    };
+
+    /*
+    Allocator that carves ALIGNMENT-aligned allocations from an OscillatorArena. A
+    default-constructed allocator has no arena and falls back to the heap.
+    */
+    template <typename T, std::size_t ALIGNMENT>
+    class ArenaAllocator {
+        template <typename U, std::size_t OTHER_ALIGNMENT>
+        friend class ArenaAllocator;
+
+        OscillatorArena* arena;
+
+        public:
+            using value_type = T;
+
+            template <typename U>
+            struct rebind {
+                using other = ArenaAllocator<U, ALIGNMENT>;
+            };
+
+            ArenaAllocator() noexcept : arena(nullptr) {}
+
+            ArenaAllocator(OscillatorArena* arena) noexcept : arena(arena) {}
+
+            template <typename U>
+            ArenaAllocator(const ArenaAllocator<U, ALIGNMENT>& other) noexcept : arena(other.arena) {}
+
+            T* allocate(std::size_t n) {
+                if (this->arena == nullptr) {
+                    return AlignedAllocator<T, ALIGNMENT>().allocate(n);
+                }
+                return static_cast<T*>(this->arena->allocate(n * sizeof(T), ALIGNMENT));
+            }
+
+            void deallocate(T* ptr, std::size_t n) noexcept {
+                if (this->arena == nullptr) {
+                    AlignedAllocator<T, ALIGNMENT>().deallocate(ptr, n);
+                }
+            }
+
+            template <typename U>
+            bool operator==(const ArenaAllocator<U, ALIGNMENT>& other) const {
+                return this->arena == other.arena;
+            }
+
+            template <typename U>
+            bool operator!=(const ArenaAllocator<U, ALIGNMENT>& other) const {
+                return this->arena != other.arena;
+            }
+        // public
+    };
+
+    template <typename T, std::size_t ALIGNMENT>
+    struct allocator_alignment<ArenaAllocator<T, ALIGNMENT>> {
+        static constexpr std::size_t value = ALIGNMENT;
+    };
+
+    template <typename T, std::size_t ALIGNMENT>
+    inline constexpr std::size_t arena_allocation_size(std::size_t n) {
+        return ((n * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+    }
+
+    template <typename OscillatorT>
+    struct oscillator_arena_size {
+        /* Arena bytes needed per oscillator, or 0 if the oscillator does not allocate from an arena. */
+        static constexpr std::size_t value = 0;
+    };
+}}}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_COMMAND_QUEUE_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_COMMAND_QUEUE_HPP
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Wait-free single-producer, single-consumer queue on a fixed ring buffer.
+
+    One thread may push and one (other) thread may pop at the same time. Neither side ever waits
+    or allocates: push fails when the queue is full and pop fails when it is empty. The capacity
+    is rounded up to a power of two.
+    */
+    template <typename T>
+    class SpscQueue {
+        using size_t = std::size_t;
+
+        struct Position {
+            std::atomic<size_t> value;
+            char padding[64 - sizeof(std::atomic<size_t>)]; // Keep each position on its own cache line.
+        };
+
+        size_t capacity_;
+        std::unique_ptr<T[]> slots;
+        Position pop_position;
+        Position push_position;
+
+        static size_t round_up_to_power_of_two(size_t n) {
+            size_t power = 1;
+            while (power < n) {
+                power *= 2;
+            }
+            return power;
+        }
+
+        public:
+            SpscQueue(size_t capacity) :
+                capacity_(round_up_to_power_of_two(capacity)),
+                slots(new T[round_up_to_power_of_two(capacity)])
+            {
+                if (capacity == 0) {
+                    std::ostringstream msg;
+                    msg << "The queue capacity "
+                        << "(capacity = " << capacity << ") "
+                        << "must be positive";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                this->pop_position.value.store(0, std::memory_order_relaxed);
+                this->push_position.value.store(0, std::memory_order_relaxed);
+            }
+
+            size_t capacity() const {
+                return this->capacity_;
+            }
+
+            /* Producer side. Returns false, without waiting, if the queue is full. */
+            bool try_push(const T& item) {
+                auto push_position = this->push_position.value.load(std::memory_order_relaxed);
+                auto pop_position = this->pop_position.value.load(std::memory_order_acquire);
+
+                if (push_position - pop_position == this->capacity_) {
+                    return false;
+                }
+
+                this->slots[push_position & (this->capacity_ - 1)] = item;
+                this->push_position.value.store(push_position + 1, std::memory_order_release);
+                return true;
+            }
+
+            /* Consumer side. Returns false, without waiting, if the queue is empty. */
+            bool try_pop(T& item) {
+                auto pop_position = this->pop_position.value.load(std::memory_order_relaxed);
+                auto push_position = this->push_position.value.load(std::memory_order_acquire);
+
+                if (pop_position == push_position) {
+                    return false;
+                }
+
+                item = this->slots[pop_position & (this->capacity_ - 1)];
+                this->pop_position.value.store(pop_position + 1, std::memory_order_release);
+                return true;
+            }
+        // public
+    };
+
+    template <typename sample_type>
+    struct ResetOscCommand {
+        std::size_t osc_id;
+        sample_type freq;
+        sample_type ampl;
+        sample_type phase;
+    };
+}}}
+
+#endif
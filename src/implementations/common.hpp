@@ -3,9 +3,19 @@
 
 #include <cmath>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include "xsimd/xsimd.hpp"
 
-namespace goldenrockefeller{ namespace fast_additive_comparison{
+// Translation units that are compiled for a specific instruction set define this as the name of
+// that instruction set (before including any header), so that the inline code they instantiate
+// gets symbols of its own instead of being merged with code built for another instruction set.
+#ifndef GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA
+#define GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA default_isa
+#endif
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
     // template <typename T>
     // struct typed_constants{
     //     static const T pi;
@@ -45,6 +55,8 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
     // template <>
     // struct typed_constants<long double> : typed_constants_numeric<long double> {};
 
+    inline constexpr std::size_t cache_line_size() {return 64;}
+
     template <typename T>
     inline T wrap_phase(const T& phase) { 
         /* Wrap phase between -pi, and pi */
@@ -89,68 +101,778 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
         *ptr = operand;
     }
 
-    
-    template<>
-	inline void load<float, xsimd::batch<float, xsimd::avx>>(const float* ptr, xsimd::batch<float, xsimd::avx>& operand) {
-		operand = xsimd::batch<float, xsimd::avx>::load_unaligned(ptr);
-	}
 
-	template<>
-	inline void store<float, xsimd::batch<float, xsimd::avx>>(float* ptr, const xsimd::batch<float, xsimd::avx>& operand) {
-		operand.store_unaligned(ptr);
-	}
+    // Overloads for every xsimd instruction set, so that the same code can be built for each
+    // instruction set that the program dispatches to at runtime.
+    template <typename sample_type, typename arch_type>
+    inline void load(const sample_type* ptr, xsimd::batch<sample_type, arch_type>& operand) {
+        operand = xsimd::batch<sample_type, arch_type>::load_unaligned(ptr);
+    }
 
-        
-    template<>
-	inline void load<double, xsimd::batch<double, xsimd::avx>>(const double* ptr, xsimd::batch<double, xsimd::avx>& operand) {
-		operand = xsimd::batch<double, xsimd::avx>::load_unaligned(ptr);
-	}
+    template <typename sample_type, typename arch_type>
+    inline void store(sample_type* ptr, const xsimd::batch<sample_type, arch_type>& operand) {
+        operand.store_unaligned(ptr);
+    }
 
-	template<>
-	inline void store<double, xsimd::batch<double, xsimd::avx>>(double* ptr, const xsimd::batch<double, xsimd::avx>& operand) {
-		operand.store_unaligned(ptr);
-	}
+    template <typename sample_type, typename operand_type>
+    inline void load_aligned(const sample_type* ptr, operand_type& operand);
+
+    template <typename sample_type>
+    inline void load_aligned(const sample_type* ptr, sample_type& operand) {
+        operand = *ptr;
+    }
+
+    template <typename sample_type, typename operand_type>
+    inline void store_aligned(sample_type* ptr, const operand_type& operand);
+
+    template <typename sample_type>
+    inline void store_aligned(sample_type* ptr, const sample_type& operand) {
+        *ptr = operand;
+    }
+
+    template <typename sample_type, typename arch_type>
+    inline void load_aligned(const sample_type* ptr, xsimd::batch<sample_type, arch_type>& operand) {
+        operand = xsimd::batch<sample_type, arch_type>::load_aligned(ptr);
+    }
+
+    template <typename sample_type, typename arch_type>
+    inline void store_aligned(sample_type* ptr, const xsimd::batch<sample_type, arch_type>& operand) {
+        operand.store_aligned(ptr);
+    }
+
+    /*
+    Allocator that aligns every allocation to ALIGNMENT bytes. It over-allocates, and keeps the
+    original pointer just before the aligned block.
+    */
+    template <typename T, std::size_t ALIGNMENT>
+    class AlignedAllocator {
+        static_assert(ALIGNMENT >= alignof(void*), "The alignment must be at least the alignment of a pointer");
+        static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "The alignment must be a power of two");
+
+        public:
+            using value_type = T;
+
+            template <typename U>
+            struct rebind {
+                using other = AlignedAllocator<U, ALIGNMENT>;
+            };
+
+            AlignedAllocator() noexcept {}
+
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept {}
+
+            T* allocate(std::size_t n) {
+                void* raw_ptr = ::operator new(n * sizeof(T) + ALIGNMENT + sizeof(void*));
+                auto raw_address = reinterpret_cast<std::uintptr_t>(raw_ptr) + sizeof(void*);
+                auto aligned_address = (raw_address + ALIGNMENT - 1) & ~std::uintptr_t(ALIGNMENT - 1);
+                reinterpret_cast<void**>(aligned_address)[-1] = raw_ptr;
+                return reinterpret_cast<T*>(aligned_address);
+            }
+
+            void deallocate(T* ptr, std::size_t) noexcept {
+                ::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+            }
+        // public
+    };
+
+    template <typename T, typename U, std::size_t ALIGNMENT>
+    inline bool operator==(const AlignedAllocator<T, ALIGNMENT>&, const AlignedAllocator<U, ALIGNMENT>&) {return true;}
+
+    template <typename T, typename U, std::size_t ALIGNMENT>
+    inline bool operator!=(const AlignedAllocator<T, ALIGNMENT>&, const AlignedAllocator<U, ALIGNMENT>&) {return false;}
+
+    template <typename AllocatorT>
+    struct allocator_alignment {
+        /* Alignment that every allocation of the allocator is guaranteed to have. */
+        static constexpr std::size_t value = alignof(typename AllocatorT::value_type);
+    };
+
+    template <typename T, std::size_t ALIGNMENT>
+    struct allocator_alignment<AlignedAllocator<T, ALIGNMENT>> {
+        static constexpr std::size_t value = ALIGNMENT;
+    };
+
+    /*
+    Operand load and store for memory that holds operands at multiples of the operand size from
+    the start of an allocation. Aligned access is used when the allocator guarantees it.
+    */
+    template <bool IS_ALIGNED>
+    struct OperandAccess {
+        template <typename sample_type, typename operand_type>
+        static inline void load(const sample_type* ptr, operand_type& operand) {
+            load_aligned(ptr, operand);
+        }
+
+        template <typename sample_type, typename operand_type>
+        static inline void store(sample_type* ptr, const operand_type& operand) {
+            store_aligned(ptr, operand);
+        }
+    };
+
+    template <>
+    struct OperandAccess<false> {
+        template <typename sample_type, typename operand_type>
+        static inline void load(const sample_type* ptr, operand_type& operand) {
+            goldenrockefeller::fast_additive_comparison::load(ptr, operand);
+        }
+
+        template <typename sample_type, typename operand_type>
+        static inline void store(sample_type* ptr, const operand_type& operand) {
+            goldenrockefeller::fast_additive_comparison::store(ptr, operand);
+        }
+    };
+
+    template <typename operand_type, typename AllocatorT>
+    struct allocator_operand_access {
+        using type = OperandAccess<(allocator_alignment<AllocatorT>::value >= sizeof(operand_type))>;
+    };
+
+    template <typename sample_type, typename operand_type>
+    inline sample_type reduce_add(const operand_type& operand);
+
+    template <typename sample_type>
+    inline sample_type reduce_add(const sample_type& operand) {
+        return operand;
+    }
+
+    template <typename sample_type, typename arch_type>
+    inline sample_type reduce_add(const xsimd::batch<sample_type, arch_type>& operand) {
+        return xsimd::reduce_add(operand);
+    }
 
     template <typename operand_type>
-    inline operand_type approx_cos_deg_14(const operand_type& x) {
-        // TODO replace with FMA
+    inline operand_type abs_operand(const operand_type& x) {
+        return std::abs(x);
+    }
 
-        // ((C0 + C2 x2) + (C4 + c6 x2) x4) + ((C8 + C10 x2) + (C12 + c14 x2) x4) x8
+    template <typename sample_type, typename arch_type>
+    inline xsimd::batch<sample_type, arch_type> abs_operand(const xsimd::batch<sample_type, arch_type>& x) {
+        return xsimd::abs(x);
+    }
 
-        const operand_type c0 = operand_type(0x1.ffffffff470fdp-1);
-        const operand_type c2 = operand_type(-0x1.ffffffec1c40dp-2);
-        const operand_type c4 = operand_type(0x1.555553f050eb2p-5);
-        const operand_type c6 = operand_type(-0x1.6c169b776ec06p-10);
-        const operand_type c8 = operand_type(0x1.a0160ea01af9bp-16);
-        const operand_type c10 = operand_type(-0x1.27abf550a036ap-22);
-        const operand_type c12 = operand_type(0x1.1b5c0b8055789p-29);
-        const operand_type c14 = operand_type(-0x1.577f9d3aa99cep-37);
-
-        auto x2 = x * x;
-        auto x4 = x2 * x2;
-        auto x8 = x4 * x4;
-        return ((c0 + c2 * x2) + (c4 + c6 *x2)* x4) + ((c8 + c10* x2) + (c12 + c14 *x2) *x4) *x8;
-        
+    template <typename operand_type>
+    inline operand_type floor_operand(const operand_type& x) {
+        return std::floor(x);
+    }
+
+    template <typename sample_type, typename arch_type>
+    inline xsimd::batch<sample_type, arch_type> floor_operand(const xsimd::batch<sample_type, arch_type>& x) {
+        return xsimd::floor(x);
+    }
+
+    /* Load table[ids] for every lane. The ids are non-negative whole numbers held as samples. */
+    template <typename operand_type, typename table_sample_type>
+    inline operand_type gather_operand(const table_sample_type* table, const operand_type& ids) {
+        return operand_type(table[std::size_t(ids)]);
     }
 
+    template <typename sample_type, typename arch_type, typename table_sample_type>
+    inline xsimd::batch<sample_type, arch_type> gather_operand(const table_sample_type* table, const xsimd::batch<sample_type, arch_type>& ids) {
+        return xsimd::batch<sample_type, arch_type>::gather(table, xsimd::to_int(ids));
+    }
+
+    /*
+    How a polynomial is evaluated. Horner evaluates one coefficient after the other; Estrin
+    evaluates pairs of coefficients independently and combines them with powers of the argument,
+    which shortens the dependency chain. The fused schemes do every multiply-add as a single fused
+    multiply-add.
+    */
+    enum class PolynomialScheme {
+        horner,
+        estrin,
+        fused_horner,
+        fused_estrin
+    };
+
     template <typename operand_type>
-    inline operand_type approx_cos_deg_10(const operand_type& x) {
-        // TODO replace with FMA
+    inline operand_type fused_multiply_add(const operand_type& x, const operand_type& y, const operand_type& z) {
+        return std::fma(x, y, z);
+    }
 
-        // ((C0 + C2 x2) + (C4 + c6 x2) x4) + (C8 + C10 x2) x8
+    template <typename sample_type, typename arch_type>
+    inline xsimd::batch<sample_type, arch_type> fused_multiply_add(
+        const xsimd::batch<sample_type, arch_type>& x, 
+        const xsimd::batch<sample_type, arch_type>& y, 
+        const xsimd::batch<sample_type, arch_type>& z
+    ) {
+        return xsimd::fma(x, y, z);
+    }
+
+    template <bool IS_FUSED>
+    struct MultiplyAdd {
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type& x, const operand_type& y, const operand_type& z) {
+            return x * y + z;
+        }
+    };
+
+    template <>
+    struct MultiplyAdd<true> {
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type& x, const operand_type& y, const operand_type& z) {
+            return fused_multiply_add(x, y, z);
+        }
+    };
+
+    inline constexpr std::size_t floor_log_2(std::size_t n) {
+        return (n <= 1) ? 0 : 1 + floor_log_2(n / 2);
+    }
+
+    /*
+    Coefficients c0, c2, c4, ... of an even polynomial in x that approximates cos(x) on [-pi, pi].
+
+    The degree 10 and 14 coefficients are the ones that approx_cos_deg_10 and approx_cos_deg_14
+    have always used. The others minimize the maximum absolute error on [-pi, pi]: about 1.4e-3
+    for degree 6, 4.0e-5 for degree 8 and 1.1e-8 for degree 12.
+    */
+    template <std::size_t DEGREE, typename coefficient_type = double>
+    struct CosinePolynomialCoefficients;
+
+    template <typename coefficient_type>
+    struct CosinePolynomialCoefficients<6, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 4;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ff495d20bf032p-1),
+            coefficient_type(-0x1.fb3ceb483fdb5p-2),
+            coefficient_type(0x1.415a687209decp-5),
+            coefficient_type(-0x1.fc62a24e89464p-11)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type CosinePolynomialCoefficients<6, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct CosinePolynomialCoefficients<8, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 5;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.fffabaf1b0565p-1),
+            coefficient_type(-0x1.ffc9c4d69b070p-2),
+            coefficient_type(0x1.53ef7555bf7fap-5),
+            coefficient_type(-0x1.5f1497f273d82p-10),
+            coefficient_type(0x1.3b464c15f429cp-16)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type CosinePolynomialCoefficients<8, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct CosinePolynomialCoefficients<10, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 6;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffeae5f1250p-1),
+            coefficient_type(-0x1.fffeb753ad1bbp-2),
+            coefficient_type(0x1.55487f14c051dp-5),
+            coefficient_type(-0x1.6b5c05901b865p-10),
+            coefficient_type(0x1.9682ebc930c70p-16),
+            coefficient_type(-0x1.da3f341d8d3f1p-23)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type CosinePolynomialCoefficients<10, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct CosinePolynomialCoefficients<12, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 7;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffffa2fd9b7p-1),
+            coefficient_type(-0x1.fffff8bdc889cp-2),
+            coefficient_type(0x1.5554f69749d21p-5),
+            coefficient_type(-0x1.6c0f802c11fc5p-10),
+            coefficient_type(0x1.9f9231e052723p-16),
+            coefficient_type(-0x1.22c451ead88e2p-22),
+            coefficient_type(0x1.da193ed867c06p-30)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type CosinePolynomialCoefficients<12, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct CosinePolynomialCoefficients<14, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 8;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffffff470fdp-1),
+            coefficient_type(-0x1.ffffffec1c40dp-2),
+            coefficient_type(0x1.555553f050eb2p-5),
+            coefficient_type(-0x1.6c169b776ec06p-10),
+            coefficient_type(0x1.a0160ea01af9bp-16),
+            coefficient_type(-0x1.27abf550a036ap-22),
+            coefficient_type(0x1.1b5c0b8055789p-29),
+            coefficient_type(-0x1.577f9d3aa99cep-37)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type CosinePolynomialCoefficients<14, coefficient_type>::values[];
+
+    /*
+    Coefficients s1, s3, s5, ... of an odd polynomial in x that approximates sin(x) on [-pi, pi],
+    stored as the even polynomial S with sin(x) ~ x S(x^2). Each degree has as many coefficients
+    as the cosine polynomial one degree lower, so that approx_sincos can share the powers of x^2.
+    They minimize the maximum absolute error on [-pi, pi]: about 2.5e-4 for degree 7, 5.9e-6 for
+    degree 9, 9.5e-8 for degree 11, 1.1e-9 for degree 13 and 1.1e-11 for degree 15.
+    */
+    template <std::size_t DEGREE, typename coefficient_type = double>
+    struct SinePolynomialCoefficients;
+
+    template <typename coefficient_type>
+    struct SinePolynomialCoefficients<7, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 4;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffa11641c0c68p-1),
+            coefficient_type(-0x1.5349366f460cfp-3),
+            coefficient_type(0x1.04c50f98977d9p-7),
+            coefficient_type(-0x1.303f9d79d2041p-13)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type SinePolynomialCoefficients<7, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct SinePolynomialCoefficients<9, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 5;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.fffd4c6107d19p-1),
+            coefficient_type(-0x1.553f2a6919f81p-3),
+            coefficient_type(0x1.1044d17dbadd6p-7),
+            coefficient_type(-0x1.94042af0f8e43p-13),
+            coefficient_type(0x1.20485f56672c4p-19)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type SinePolynomialCoefficients<9, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct SinePolynomialCoefficients<11, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 6;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.fffff2b5b9df6p-1),
+            coefficient_type(-0x1.5554bd5f63570p-3),
+            coefficient_type(0x1.11094d1001ff9p-7),
+            coefficient_type(-0x1.9f6b5d1856ac8p-13),
+            coefficient_type(0x1.6a5d34e13f929p-19),
+            coefficient_type(-0x1.5de3a3831e366p-26)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type SinePolynomialCoefficients<11, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct SinePolynomialCoefficients<13, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 7;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffffd0e483bp-1),
+            coefficient_type(-0x1.55555288fd478p-3),
+            coefficient_type(0x1.1110dfcd15ab0p-7),
+            coefficient_type(-0x1.a01405e34a723p-13),
+            coefficient_type(0x1.717e7c1f72475p-19),
+            coefficient_type(-0x1.a7f2773b1b1d7p-26),
+            coefficient_type(0x1.27cd1bf69d72ep-33)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type SinePolynomialCoefficients<13, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct SinePolynomialCoefficients<15, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 8;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffffff81f2ap-1),
+            coefficient_type(-0x1.5555554bb8935p-3),
+            coefficient_type(0x1.1111103613a92p-7),
+            coefficient_type(-0x1.a019de9a1d19ap-13),
+            coefficient_type(0x1.71db40f3ed0a9p-19),
+            coefficient_type(-0x1.ae1acf808f3fep-26),
+            coefficient_type(0x1.5d1419848116bp-33),
+            coefficient_type(-0x1.70bd13297e714p-41)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type SinePolynomialCoefficients<15, coefficient_type>::values[];
+
+    /*
+    Like SinePolynomialCoefficients, but fitted on [-pi/2, pi/2] only, for approx_cos_quarter_wave.
+    The maximum absolute error is about 6.8e-5 for degree 5, 5.9e-7 for degree 7, 3.3e-9 for
+    degree 9 and 1.3e-11 for degree 11.
+    */
+    template <std::size_t DEGREE, typename coefficient_type = double>
+    struct QuarterWaveSinePolynomialCoefficients;
+
+    template <typename coefficient_type>
+    struct QuarterWaveSinePolynomialCoefficients<5, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 3;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffd84165163bep-1),
+            coefficient_type(-0x1.534c684beafccp-3),
+            coefficient_type(0x1.ec765439185cfp-8)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type QuarterWaveSinePolynomialCoefficients<5, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct QuarterWaveSinePolynomialCoefficients<7, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 4;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffff8e72dfd61p-1),
+            coefficient_type(-0x1.554bb20788becp-3),
+            coefficient_type(0x1.102e819a352f2p-7),
+            coefficient_type(-0x1.811d1de05ef68p-13)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type QuarterWaveSinePolynomialCoefficients<7, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct QuarterWaveSinePolynomialCoefficients<9, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 5;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffff36e89c4p-1),
+            coefficient_type(-0x1.55553bc9fa950p-3),
+            coefficient_type(0x1.110d6e1c6f55cp-7),
+            coefficient_type(-0x1.9f4142a9c1fcap-13),
+            coefficient_type(0x1.5bb081d1f2080p-19)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type QuarterWaveSinePolynomialCoefficients<9, coefficient_type>::values[];
+
+    template <typename coefficient_type>
+    struct QuarterWaveSinePolynomialCoefficients<11, coefficient_type> {
+        static constexpr std::size_t N_COEFFICIENTS = 6;
+        static constexpr coefficient_type values[N_COEFFICIENTS] = {
+            coefficient_type(0x1.ffffffff0dc82p-1),
+            coefficient_type(-0x1.5555552a4e337p-3),
+            coefficient_type(0x1.111108542d80dp-7),
+            coefficient_type(-0x1.a016f660317adp-13),
+            coefficient_type(0x1.715a116787f17p-19),
+            coefficient_type(-0x1.98ca41bd6adf1p-26)
+        };
+    };
+
+    template <typename coefficient_type>
+    constexpr coefficient_type QuarterWaveSinePolynomialCoefficients<11, coefficient_type>::values[];
+
+    /* Horner evaluation of coefficients [I, I + N) at y. */
+    template <typename CoefficientsT, bool IS_FUSED, std::size_t I, std::size_t N>
+    struct HornerPolynomial {
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type& y) {
+            return MultiplyAdd<IS_FUSED>::eval(
+                HornerPolynomial<CoefficientsT, IS_FUSED, I + 1, N - 1>::eval(y), 
+                y, 
+                operand_type(CoefficientsT::values[I])
+            );
+        }
+    };
+
+    template <typename CoefficientsT, bool IS_FUSED, std::size_t I>
+    struct HornerPolynomial<CoefficientsT, IS_FUSED, I, 1> {
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type&) {
+            return operand_type(CoefficientsT::values[I]);
+        }
+    };
+
+    /* 
+    Estrin evaluation of coefficients [I, I + N) at y, where y_powers[k] holds y^(2^k). The lower
+    half is the largest power-of-two number of coefficients that leaves at least one coefficient
+    for the upper half.
+    */
+    template <typename CoefficientsT, bool IS_FUSED, std::size_t I, std::size_t N>
+    struct EstrinPolynomial {
+        static constexpr std::size_t LOG_2_N_LOWER = floor_log_2(N - 1);
+        static constexpr std::size_t N_LOWER = std::size_t(1) << LOG_2_N_LOWER;
+
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type* y_powers) {
+            return MultiplyAdd<IS_FUSED>::eval(
+                EstrinPolynomial<CoefficientsT, IS_FUSED, I + N_LOWER, N - N_LOWER>::eval(y_powers), 
+                y_powers[LOG_2_N_LOWER],
+                EstrinPolynomial<CoefficientsT, IS_FUSED, I, N_LOWER>::eval(y_powers)
+            );
+        }
+    };
+
+    template <typename CoefficientsT, bool IS_FUSED, std::size_t I>
+    struct EstrinPolynomial<CoefficientsT, IS_FUSED, I, 1> {
+        template <typename operand_type>
+        static inline operand_type eval(const operand_type*) {
+            return operand_type(CoefficientsT::values[I]);
+        }
+    };
+
+    template <bool IS_FUSED>
+    struct HornerPolynomialEvaluator {
+        template <typename CoefficientsT, typename operand_type>
+        static inline operand_type eval(const operand_type& y) {
+            return HornerPolynomial<CoefficientsT, IS_FUSED, 0, CoefficientsT::N_COEFFICIENTS>::eval(y);
+        }
+
+        /* Evaluate two polynomials at the same y. */
+        template <typename CoefficientsT, typename OtherCoefficientsT, typename operand_type>
+        static inline void eval_pair(const operand_type& y, operand_type& result, operand_type& other_result) {
+            result = HornerPolynomial<CoefficientsT, IS_FUSED, 0, CoefficientsT::N_COEFFICIENTS>::eval(y);
+            other_result = HornerPolynomial<OtherCoefficientsT, IS_FUSED, 0, OtherCoefficientsT::N_COEFFICIENTS>::eval(y);
+        }
+    };
+
+    template <bool IS_FUSED>
+    struct EstrinPolynomialEvaluator {
+        template <std::size_t N_COEFFICIENTS, typename operand_type>
+        static inline void get_y_powers(const operand_type& y, operand_type* y_powers) {
+            static constexpr std::size_t N_Y_POWERS = floor_log_2(N_COEFFICIENTS - 1) + 1;
+
+            y_powers[0] = y;
+            for (std::size_t k = 1; k < N_Y_POWERS; k++) {
+                y_powers[k] = y_powers[k - 1] * y_powers[k - 1];
+            }
+        }
+
+        template <typename CoefficientsT, typename operand_type>
+        static inline operand_type eval(const operand_type& y) {
+            operand_type y_powers[floor_log_2(CoefficientsT::N_COEFFICIENTS - 1) + 1];
+            get_y_powers<CoefficientsT::N_COEFFICIENTS>(y, y_powers);
+
+            return EstrinPolynomial<CoefficientsT, IS_FUSED, 0, CoefficientsT::N_COEFFICIENTS>::eval(y_powers);
+        }
+
+        /* Evaluate two polynomials at the same y, computing the powers of y once. */
+        template <typename CoefficientsT, typename OtherCoefficientsT, typename operand_type>
+        static inline void eval_pair(const operand_type& y, operand_type& result, operand_type& other_result) {
+            static constexpr std::size_t N_COEFFICIENTS = 
+                (CoefficientsT::N_COEFFICIENTS > OtherCoefficientsT::N_COEFFICIENTS) 
+                ? CoefficientsT::N_COEFFICIENTS 
+                : OtherCoefficientsT::N_COEFFICIENTS;
+
+            operand_type y_powers[floor_log_2(N_COEFFICIENTS - 1) + 1];
+            get_y_powers<N_COEFFICIENTS>(y, y_powers);
+
+            result = EstrinPolynomial<CoefficientsT, IS_FUSED, 0, CoefficientsT::N_COEFFICIENTS>::eval(y_powers);
+            other_result = EstrinPolynomial<OtherCoefficientsT, IS_FUSED, 0, OtherCoefficientsT::N_COEFFICIENTS>::eval(y_powers);
+        }
+    };
+
+    template <PolynomialScheme SCHEME>
+    struct PolynomialEvaluator;
+
+    template <>
+    struct PolynomialEvaluator<PolynomialScheme::horner> : HornerPolynomialEvaluator<false> {};
+
+    template <>
+    struct PolynomialEvaluator<PolynomialScheme::fused_horner> : HornerPolynomialEvaluator<true> {};
+
+    template <>
+    struct PolynomialEvaluator<PolynomialScheme::estrin> : EstrinPolynomialEvaluator<false> {};
+
+    template <>
+    struct PolynomialEvaluator<PolynomialScheme::fused_estrin> : EstrinPolynomialEvaluator<true> {};
+
+    template <std::size_t DEGREE, PolynomialScheme SCHEME, typename operand_type>
+    inline operand_type approx_cos(const operand_type& x) {
+        return PolynomialEvaluator<SCHEME>::template eval<CosinePolynomialCoefficients<DEGREE>>(x * x);
+    }
 
-        const operand_type c0 = operand_type(0x1.ffffeae5f1250p-1);
-        const operand_type c2 = operand_type(-0x1.fffeb753ad1bbp-2);
-        const operand_type c4 = operand_type(0x1.55487f14c051dp-5);
-        const operand_type c6 = operand_type(-0x1.6b5c05901b865p-10);
-        const operand_type c8 = operand_type(0x1.9682ebc930c70p-16);
-        const operand_type c10 = operand_type(-0x1.da3f341d8d3f1p-23);
+    /*
+    Joint sin and cos of x in [-pi, pi]. The cosine polynomial has degree DEGREE and the sine
+    polynomial degree DEGREE + 1; both are evaluated in x^2 and share its powers.
+    */
+    template <std::size_t DEGREE, PolynomialScheme SCHEME, typename operand_type>
+    inline void approx_sincos(const operand_type& x, operand_type& sin_x, operand_type& cos_x) {
+        operand_type sin_x_over_x;
+        PolynomialEvaluator<SCHEME>::template eval_pair<CosinePolynomialCoefficients<DEGREE>, SinePolynomialCoefficients<DEGREE + 1>>(
+            x * x, cos_x, sin_x_over_x
+        );
+        sin_x = x * sin_x_over_x;
+    }
 
-        auto x2 = x * x;
-        auto x4 = x2 * x2;
-        auto x8 = x4 * x4;
-        return ((c0 + c2 * x2) + (c4 + c6 *x2)* x4) + (c8 + c10* x2) *x8;
+    /*
+    cos of x in [-pi, pi] from a polynomial fitted on a quarter period only. The phase is mirrored
+    about pi/2 with t = pi/2 - |x|, which maps [-pi, pi] onto [-pi/2, pi/2] with
+    cos(x) = sin(t); the sign of the second and third quarters then comes from the odd symmetry of
+    sin, without a branch or a select. DEGREE is the (odd) degree of the sine polynomial.
+    */
+    template <std::size_t DEGREE, PolynomialScheme SCHEME, typename operand_type>
+    inline operand_type approx_cos_quarter_wave(const operand_type& x) {
+        auto t = operand_type(0.5 * pi<double>()) - abs_operand(x);
+        return t * PolynomialEvaluator<SCHEME>::template eval<QuarterWaveSinePolynomialCoefficients<DEGREE>>(t * t);
     }
-}}
+
+    template <typename operand_type>
+    inline operand_type approx_cos_deg_14(const operand_type& x) {
+        // ((C0 + C2 x2) + (C4 + c6 x2) x4) + ((C8 + C10 x2) + (C12 + c14 x2) x4) x8
+        return approx_cos<14, PolynomialScheme::estrin>(x);
+    }
+
+    template <typename operand_type>
+    inline operand_type approx_cos_deg_10(const operand_type& x) {
+        // ((C0 + C2 x2) + (C4 + c6 x2) x4) + (C8 + C10 x2) x8
+        return approx_cos<10, PolynomialScheme::estrin>(x);
+    }
+
+    template <typename sample_type, typename operand_type>
+    inline operand_type lane_index_operand() {
+        /* Operand that holds 0, 1, 2, ... in its lanes. */
+        sample_type lane_ids[sizeof(operand_type) / sizeof(sample_type)];
+        for (std::size_t i = 0; i < sizeof(operand_type) / sizeof(sample_type); i++) {
+            lane_ids[i] = sample_type(i);
+        }
+
+        operand_type lane_ids_operand;
+        load(lane_ids, lane_ids_operand);
+        return lane_ids_operand;
+    }
+
+    /*
+    Phase-continuous, sample-accurate ramp of an oscillator's frequency and amplitude.
+
+    Tracks the phase, phase increment and amplitude at the first sample of the oscillator's
+    current block. While ramping, the phase increment and amplitude move linearly per sample
+    towards their targets, so the phase of sample k of the block has the closed form
+    base_phase + k * delta_phase + delta_phase_step * k * (k - 1) / 2, which lets a whole
+    operand of phases be generated at once.
+    */
+    template <typename sample_type, typename operand_type>
+    class PhaseAmplitudeRamp {
+        using size_t = std::size_t;
+        using ptrdiff_t = std::ptrdiff_t;
+
+        sample_type base_phase;
+        sample_type delta_phase;
+        sample_type delta_phase_step;
+        sample_type target_delta_phase;
+        sample_type ampl;
+        sample_type ampl_step;
+        sample_type target_ampl;
+        size_t n_ramp_samples;
+
+        sample_type n_ramp_samples_until(ptrdiff_t sample_id) const {
+            if (sample_id <= 0) {
+                return sample_type(0.);
+            }
+            return sample_type(size_t(sample_id) < this->n_ramp_samples ? size_t(sample_id) : this->n_ramp_samples);
+        }
+
+        public:
+            PhaseAmplitudeRamp() : PhaseAmplitudeRamp(sample_type(0), sample_type(0), sample_type(0)) {}
+
+            PhaseAmplitudeRamp(sample_type freq, sample_type ampl, sample_type phase) {
+                this->reset(freq, ampl, phase);
+            }
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                this->base_phase = wrap_phase(phase);
+                this->delta_phase = tau<sample_type>() * freq;
+                this->delta_phase_step = sample_type(0.);
+                this->target_delta_phase = this->delta_phase;
+                this->ampl = ampl;
+                this->ampl_step = sample_type(0.);
+                this->target_ampl = ampl;
+                this->n_ramp_samples = 0;
+            }
+
+            bool is_ramping() const {
+                return this->n_ramp_samples > 0;
+            }
+
+            sample_type final_freq() const {
+                return this->target_delta_phase * inv_tau<sample_type>();
+            }
+
+            sample_type final_ampl() const {
+                return this->target_ampl;
+            }
+
+            /* Phase of a sample of the current block (negative ids extrapolate into the previous block). */
+            sample_type phase_at(ptrdiff_t sample_id) const {
+                auto n_ramped = this->n_ramp_samples_until(sample_id);
+                return wrap_phase(
+                    this->base_phase 
+                    + n_ramped * this->delta_phase
+                    + this->delta_phase_step * n_ramped * (n_ramped - sample_type(1.)) * sample_type(0.5)
+                    + (sample_type(sample_id) - n_ramped) * this->target_delta_phase
+                );
+            }
+
+            /* Start a new ramp at a sample of the current block, which becomes the first sample of the new block. */
+            void start(ptrdiff_t sample_id, sample_type freq, sample_type ampl, size_t n_samples) {
+                auto n_ramped = this->n_ramp_samples_until(sample_id);
+                auto new_base_phase = this->phase_at(sample_id);
+                auto new_delta_phase = this->delta_phase + n_ramped * this->delta_phase_step;
+                auto new_ampl = this->ampl + n_ramped * this->ampl_step;
+
+                if (sample_id > 0 && size_t(sample_id) >= this->n_ramp_samples) {
+                    new_delta_phase = this->target_delta_phase;
+                    new_ampl = this->target_ampl;
+                }
+
+                this->base_phase = new_base_phase;
+                this->target_delta_phase = tau<sample_type>() * freq;
+                this->target_ampl = ampl;
+                this->n_ramp_samples = n_samples;
+
+                if (n_samples == 0) {
+                    this->delta_phase = this->target_delta_phase;
+                    this->ampl = this->target_ampl;
+                    this->delta_phase_step = sample_type(0.);
+                    this->ampl_step = sample_type(0.);
+                }
+                else {
+                    this->delta_phase = new_delta_phase;
+                    this->ampl = new_ampl;
+                    this->delta_phase_step = (this->target_delta_phase - new_delta_phase) / sample_type(n_samples);
+                    this->ampl_step = (this->target_ampl - new_ampl) / sample_type(n_samples);
+                }
+            }
+
+            /* Move the start of the current block forward by n_samples. */
+            void advance(size_t n_samples) {
+                auto n_ramped = this->n_ramp_samples_until(std::ptrdiff_t(n_samples));
+                this->base_phase = this->phase_at(std::ptrdiff_t(n_samples));
+                this->n_ramp_samples -= size_t(n_ramped);
+
+                if (this->n_ramp_samples == 0) {
+                    this->delta_phase = this->target_delta_phase;
+                    this->ampl = this->target_ampl;
+                    this->delta_phase_step = sample_type(0.);
+                    this->ampl_step = sample_type(0.);
+                }
+                else {
+                    this->delta_phase += n_ramped * this->delta_phase_step;
+                    this->ampl += n_ramped * this->ampl_step;
+                }
+            }
+
+            /* Phases and amplitudes of the operand that starts at a sample of the current block. */
+            void get_operands(size_t sample_id, operand_type& phase_operand, operand_type& ampl_operand) const {
+                operand_type sample_id_operand = lane_index_operand<sample_type, operand_type>() + operand_type(sample_type(sample_id));
+                operand_type n_ramp_samples_operand(sample_type(this->n_ramp_samples));
+                operand_type n_ramped_operand = 
+                    sample_id_operand 
+                    - (sample_id_operand - n_ramp_samples_operand) * operand_type(sample_id_operand > n_ramp_samples_operand);
+
+                phase_operand = wrap_phase(
+                    operand_type(this->base_phase)
+                    + n_ramped_operand * operand_type(this->delta_phase)
+                    + operand_type(this->delta_phase_step * sample_type(0.5)) * n_ramped_operand * (n_ramped_operand - operand_type(sample_type(1.)))
+                    + (sample_id_operand - n_ramped_operand) * operand_type(this->target_delta_phase)
+                );
+                ampl_operand = operand_type(this->ampl) + n_ramped_operand * operand_type(this->ampl_step);
+            }
+        // public
+    };
+}}}
 
 #endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_FFT_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_FFT_HPP
+#include <cstddef>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    In-place, iterative radix-2 complex FFT of a fixed power-of-two size. The twiddle factors and
+    the bit-reversal permutation are computed once, on construction. Neither direction is
+    normalized.
+    */
+    template <typename sample_type>
+    class FastFourierTransform {
+        using size_t = std::size_t;
+
+        public:
+            using complex_type = std::complex<sample_type>;
+
+        private:
+            size_t n;
+            std::vector<complex_type> twiddles; // exp(-i tau k / n) for k < n / 2
+            std::vector<size_t> bit_reversed_ids;
+
+            void transform(std::vector<complex_type>& data, bool is_inverse) const {
+                if (data.size() != this->n) {
+                    std::ostringstream msg;
+                    msg << "The data size "
+                        << "(data.size() = " << data.size() << ") "
+                        << "must be equal to the transform size "
+                        << "(n = " << this->n << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t i = 0; i < this->n; i++) {
+                    if (i < this->bit_reversed_ids[i]) {
+                        std::swap(data[i], data[this->bit_reversed_ids[i]]);
+                    }
+                }
+
+                for (size_t len = 2; len <= this->n; len *= 2) {
+                    size_t half_len = len / 2;
+                    size_t twiddle_stride = this->n / len;
+
+                    for (size_t i = 0; i < this->n; i += len) {
+                        for (size_t j = 0; j < half_len; j++) {
+                            auto twiddle = this->twiddles[j * twiddle_stride];
+                            if (is_inverse) {
+                                twiddle = std::conj(twiddle);
+                            }
+
+                            auto even = data[i + j];
+                            auto odd = data[i + j + half_len] * twiddle;
+                            data[i + j] = even + odd;
+                            data[i + j + half_len] = even - odd;
+                        }
+                    }
+                }
+            }
+
+        public:
+            FastFourierTransform(size_t n) : n(n), twiddles(n / 2), bit_reversed_ids(n) {
+                if (n < 2 || (n & (n - 1)) != 0) {
+                    std::ostringstream msg;
+                    msg << "The transform size "
+                        << "(n = " << n << ") "
+                        << "must be a power of two greater than 1";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t k = 0; k < n / 2; k++) {
+                    auto angle = -tau<double>() * double(k) / double(n);
+                    this->twiddles[k] = complex_type(sample_type(std::cos(angle)), sample_type(std::sin(angle)));
+                }
+
+                size_t n_bits = 0;
+                while ((size_t(1) << n_bits) < n) {
+                    n_bits++;
+                }
+
+                for (size_t i = 0; i < n; i++) {
+                    size_t reversed_id = 0;
+                    for (size_t bit = 0; bit < n_bits; bit++) {
+                        reversed_id |= ((i >> bit) & 1) << (n_bits - 1 - bit);
+                    }
+                    this->bit_reversed_ids[i] = reversed_id;
+                }
+            }
+
+            size_t size() const {
+                return this->n;
+            }
+
+            // X[k] = sum_n x[n] exp(-i tau k n / N)
+            void forward(std::vector<complex_type>& data) const {
+                this->transform(data, false);
+            }
+
+            // x[n] = sum_k X[k] exp(i tau k n / N), without the 1 / N factor.
+            void inverse(std::vector<complex_type>& data) const {
+                this->transform(data, true);
+            }
+        // public
+    };
+}}}
+
+#endif
@@ -0,0 +1,243 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_INVERSE_FFT_OSCILLATOR_BANK_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_INVERSE_FFT_OSCILLATOR_BANK_HPP
+#include <cstddef>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "common.hpp"
+#include "fft.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Oscillator bank that synthesizes in the frequency domain (inverse-FFT additive synthesis).
+
+    Every hop of N_FFT / 4 samples, each partial adds the spectrum of one windowed frame of itself
+    to a shared spectrum: the transform of the window, shifted to the partial's frequency and
+    truncated to the 2 * N_KERNEL_BINS + 1 bins around it. One inverse FFT then gives the sum of
+    all the windowed partials, which is overlap-added into the output. The cost per sample is
+    O(n_oscs * N_KERNEL_BINS / N_FFT + log(N_FFT)) instead of O(n_oscs), so the bank wins for
+    large numbers of partials.
+
+    The window is the 4-term Blackman-Harris window. Its side lobes are under -92 dB, so the
+    kernel can be truncated just past its main lobe (4 bins on each side), and its copies add up
+    to a constant at a hop of N_FFT / 4.
+
+    Parameter changes take effect on the next frame, so they are cross-faded over N_FFT samples.
+    */
+    template <typename sample_type, std::size_t N_FFT = 1024, std::size_t N_KERNEL_BINS = 5>
+    class InverseFftOscillatorBank {
+        static_assert(N_FFT >= 16 && (N_FFT & (N_FFT - 1)) == 0, "The FFT size must be a power of two, and at least 16");
+        static_assert(2 * N_KERNEL_BINS + 1 < N_FFT, "The kernel must be narrower than the FFT");
+
+        using size_t = std::size_t;
+        using vector_type = typename std::vector<sample_type>;
+        using complex_type = std::complex<sample_type>;
+
+        static constexpr size_t N_SAMPLES_PER_HOP = N_FFT / 4;
+        static constexpr size_t N_KERNEL_STEPS_PER_BIN = 256;
+        static constexpr size_t N_KERNEL_TABLE_ENTRIES = 2 * (N_KERNEL_BINS + 1) * N_KERNEL_STEPS_PER_BIN + 1;
+
+        static constexpr double WINDOW_COEFFICIENTS[4] = {0.35875, 0.48829, 0.14128, 0.01168};
+
+        size_t n_oscs;
+        vector_type freqs;
+        vector_type ampls;
+        vector_type phases; // At the start of the next frame.
+
+        FastFourierTransform<sample_type> fft;
+        std::vector<complex_type> spectrum;
+        const sample_type* kernel_table;
+        vector_type ola_block;
+        size_t n_used_samples;
+
+        static double window(size_t sample_id) {
+            auto angle = tau<double>() * double(sample_id) / double(N_FFT);
+            return (
+                WINDOW_COEFFICIENTS[0]
+                - WINDOW_COEFFICIENTS[1] * std::cos(angle)
+                + WINDOW_COEFFICIENTS[2] * std::cos(2. * angle)
+                - WINDOW_COEFFICIENTS[3] * std::cos(3. * angle)
+            );
+        }
+
+        /*
+        Transform of the window, centered on the middle of the frame, at offsets from
+        -(N_KERNEL_BINS + 1) to N_KERNEL_BINS + 1 bins, with N_KERNEL_STEPS_PER_BIN entries per
+        bin. The entries are scaled so that the overlap-added frames have unit amplitude.
+
+        With linear interpolation between the entries, the bank's peak error against the exact
+        cosine is about -85.5 dB (e.g. at 0.0005 cycles/sample), and its RMS error about -92 dB.
+        The error is lower only for frequencies whose bin offsets fall on table entries.
+        */
+        static vector_type new_kernel_table() {
+            vector_type kernel_table(N_KERNEL_TABLE_ENTRIES);
+            auto scale = 1. / (double(N_FFT) * double(N_FFT / N_SAMPLES_PER_HOP) * WINDOW_COEFFICIENTS[0]);
+
+            // The window is symmetric about the middle of the frame, so only its second half is
+            // needed: half_window[m] = window(N_FFT / 2 + m), with window(0) = half_window[N_FFT / 2].
+            std::vector<double> half_window(N_FFT / 2 + 1);
+            for (size_t m = 0; m < N_FFT / 2; m++) {
+                half_window[m] = window(N_FFT / 2 + m);
+            }
+            half_window[N_FFT / 2] = window(0);
+
+            for (size_t i = 0; i < N_KERNEL_TABLE_ENTRIES; i++) {
+                auto bin_offset = double(i) / double(N_KERNEL_STEPS_PER_BIN) - double(N_KERNEL_BINS + 1);
+                auto angle_step = tau<double>() * bin_offset / double(N_FFT);
+
+                // The window is symmetric about the middle of the frame, so the transform is real.
+                auto value = half_window[0] + half_window[N_FFT / 2] * std::cos(angle_step * double(N_FFT / 2));
+                for (size_t m = 1; m < N_FFT / 2; m++) {
+                    value += 2. * half_window[m] * std::cos(angle_step * double(m));
+                }
+                kernel_table[i] = sample_type(scale * value);
+            }
+
+            return kernel_table;
+        }
+
+        // The table depends only on the template parameters, so all the banks of one
+        // instantiation share it.
+        static const vector_type& shared_kernel_table() {
+            static const vector_type kernel_table = InverseFftOscillatorBank::new_kernel_table();
+            return kernel_table;
+        }
+
+        void add_osc_to_spectrum(size_t osc_id) {
+            auto freq = this->freqs[osc_id];
+            auto bin_pos = freq * sample_type(N_FFT);
+            auto center_bin = std::floor(bin_pos + sample_type(0.5));
+            auto table_pos = (bin_pos - center_bin + sample_type(N_KERNEL_BINS + 1)) * sample_type(N_KERNEL_STEPS_PER_BIN);
+            auto table_base_pos = std::floor(table_pos);
+            auto table_fraction = table_pos - table_base_pos;
+            auto table_id = size_t(table_base_pos) + N_KERNEL_BINS * N_KERNEL_STEPS_PER_BIN;
+
+            // Shifting the frame to its middle multiplies bin k by (-1)^k.
+            auto first_bin = std::ptrdiff_t(center_bin) - std::ptrdiff_t(N_KERNEL_BINS);
+            auto center_phase = this->phases[osc_id] + tau<sample_type>() * freq * sample_type(N_FFT / 2);
+            auto coefficient = this->ampls[osc_id] * complex_type(std::cos(center_phase), std::sin(center_phase));
+            if (first_bin % 2 != 0) {
+                coefficient = -coefficient;
+            }
+
+            for (size_t j = 0; j < 2 * N_KERNEL_BINS + 1; j++) {
+                auto kernel_value = (
+                    this->kernel_table[table_id] * (sample_type(1.) - table_fraction)
+                    + this->kernel_table[table_id + 1] * table_fraction
+                );
+                auto bin_id = size_t(first_bin + std::ptrdiff_t(j)) & (N_FFT - 1);
+                this->spectrum[bin_id] += coefficient * kernel_value;
+                coefficient = -coefficient;
+                table_id -= N_KERNEL_STEPS_PER_BIN;
+            }
+
+            this->phases[osc_id] = wrap_phase(this->phases[osc_id] + tau<sample_type>() * freq * sample_type(N_SAMPLES_PER_HOP));
+        }
+
+        void synthesize_frame() {
+            std::copy(this->ola_block.begin() + N_SAMPLES_PER_HOP, this->ola_block.end(), this->ola_block.begin());
+            std::fill(this->ola_block.end() - N_SAMPLES_PER_HOP, this->ola_block.end(), sample_type(0.));
+            std::fill(this->spectrum.begin(), this->spectrum.end(), complex_type(0.));
+
+            for (size_t osc_id = 0; osc_id < this->n_oscs; osc_id++) {
+                if (this->ampls[osc_id] != sample_type(0.)) {
+                    this->add_osc_to_spectrum(osc_id);
+                }
+            }
+
+            this->fft.inverse(this->spectrum);
+
+            // The negative frequencies are left out of the spectrum, and the positive ones have
+            // twice their amplitude, so the real part is the signal.
+            for (size_t i = 0; i < N_FFT; i++) {
+                this->ola_block[i] += this->spectrum[i].real();
+            }
+
+            this->n_used_samples = 0;
+        }
+
+        public:
+            typedef sample_type sample_type;
+
+            InverseFftOscillatorBank() : InverseFftOscillatorBank(0) {}
+            InverseFftOscillatorBank(size_t n_oscs) :
+                n_oscs(n_oscs),
+                freqs(n_oscs, sample_type(0.)),
+                ampls(n_oscs, sample_type(0.)),
+                phases(n_oscs, sample_type(0.)),
+                fft(N_FFT),
+                spectrum(N_FFT),
+                kernel_table(InverseFftOscillatorBank::shared_kernel_table().data()),
+                ola_block(N_FFT, sample_type(0.)),
+                n_used_samples(N_SAMPLES_PER_HOP)
+            {}
+
+            void _reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                // The phase is given for the next output sample; the next frame starts
+                // (N_SAMPLES_PER_HOP - n_used_samples) samples later.
+                auto n_samples_to_next_frame = sample_type(N_SAMPLES_PER_HOP - this->n_used_samples);
+                this->freqs[osc_id] = freq;
+                this->ampls[osc_id] = ampl;
+                this->phases[osc_id] = wrap_phase(phase + tau<sample_type>() * freq * n_samples_to_next_frame);
+            }
+
+            void reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                if (osc_id >=  this->n_oscs) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(n_oscs = " << this->n_oscs << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                this->_reset_osc(osc_id, freq, ampl, phase);
+            }
+
+            /* Reset oscillators 0 to n_oscs - 1 from contiguous arrays. */
+            void reset_oscs(const sample_type* freqs, const sample_type* ampls, const sample_type* phases, size_t n_oscs) {
+                if (n_oscs > this->n_oscs) {
+                    std::ostringstream msg;
+                    msg << "The number of oscilators to reset "
+                        << "(n_oscs = " << n_oscs << ") "
+                        << "must not be greater than the number of oscilators "
+                        << "(this->n_oscs = " << this->n_oscs << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t i = 0; i < n_oscs; i++) {
+                    this->_reset_osc(i, freqs[i], ampls[i], phases[i]);
+                }
+            }
+
+            template <typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                for (auto signal_it = signal_begin_it; signal_it < signal_end_it; ) {
+                    if (this->n_used_samples == N_SAMPLES_PER_HOP) {
+                        this->synthesize_frame();
+                    }
+
+                    auto n_samples = std::min(size_t(signal_end_it - signal_it), N_SAMPLES_PER_HOP - this->n_used_samples);
+                    auto ola_it = this->ola_block.begin() + this->n_used_samples;
+                    for (size_t i = 0; i < n_samples; i++) {
+                        signal_it[i] += ola_it[i];
+                    }
+
+                    signal_it += n_samples;
+                    this->n_used_samples += n_samples;
+                }
+            }
+        // public
+    };
+
+    template <typename sample_type, std::size_t N_FFT, std::size_t N_KERNEL_BINS>
+    constexpr double InverseFftOscillatorBank<sample_type, N_FFT, N_KERNEL_BINS>::WINDOW_COEFFICIENTS[4];
+}}}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_LOOKUP_TABLE_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_LOOKUP_TABLE_HPP
+#include <cstddef>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    template <std::size_t... IDS>
+    struct index_sequence {};
+
+    template <typename LeftSequenceT, typename RightSequenceT>
+    struct concat_index_sequences;
+
+    template <std::size_t... LEFT_IDS, std::size_t... RIGHT_IDS>
+    struct concat_index_sequences<index_sequence<LEFT_IDS...>, index_sequence<RIGHT_IDS...>> {
+        using type = index_sequence<LEFT_IDS..., (sizeof...(LEFT_IDS) + RIGHT_IDS)...>;
+    };
+
+    /* index_sequence<0, 1, ..., N - 1>, built with logarithmic template recursion depth. */
+    template <std::size_t N>
+    struct make_index_sequence {
+        using type = typename concat_index_sequences<
+            typename make_index_sequence<N / 2>::type,
+            typename make_index_sequence<N - N / 2>::type
+        >::type;
+    };
+
+    template <>
+    struct make_index_sequence<0> {
+        using type = index_sequence<>;
+    };
+
+    template <>
+    struct make_index_sequence<1> {
+        using type = index_sequence<0>;
+    };
+
+    // Taylor series, accurate to double precision for |x| <= pi / 4.
+    inline constexpr double constexpr_cos_series(double x2, std::size_t k) {
+        return (k == 12) ? 1. : 1. - x2 / double((2 * k + 1) * (2 * k + 2)) * constexpr_cos_series(x2, k + 1);
+    }
+
+    inline constexpr double constexpr_sin_series(double x2, std::size_t k) {
+        return (k == 12) ? 1. : 1. - x2 / double((2 * k + 2) * (2 * k + 3)) * constexpr_sin_series(x2, k + 1);
+    }
+
+    // cos(pi * octant_pos / (4 * n)) for octant_pos in [0, n], i.e. an angle in [0, pi / 4].
+    inline constexpr double constexpr_cos_first_octant(std::size_t octant_pos, std::size_t n) {
+        return constexpr_cos_series(
+            (pi<double>() * double(octant_pos) / double(4 * n)) * (pi<double>() * double(octant_pos) / double(4 * n)),
+            0
+        );
+    }
+
+    inline constexpr double constexpr_sin_first_octant(std::size_t octant_pos, std::size_t n) {
+        return (
+            (pi<double>() * double(octant_pos) / double(4 * n))
+            * constexpr_sin_series(
+                (pi<double>() * double(octant_pos) / double(4 * n)) * (pi<double>() * double(octant_pos) / double(4 * n)),
+                0
+            )
+        );
+    }
+
+    // cos(pi * pos / (4 * n)) for pos in [0, 2 n], i.e. an angle in [0, pi / 2].
+    inline constexpr double constexpr_cos_first_quadrant(std::size_t pos, std::size_t n) {
+        return (pos <= n) ? constexpr_cos_first_octant(pos, n) : constexpr_sin_first_octant(2 * n - pos, n);
+    }
+
+    // cos(pi * pos / (4 * n)) for pos in [0, 4 n], i.e. an angle in [0, pi].
+    inline constexpr double constexpr_cos_first_half(std::size_t pos, std::size_t n) {
+        return (pos <= 2 * n) ? constexpr_cos_first_quadrant(pos, n) : -constexpr_cos_first_quadrant(4 * n - pos, n);
+    }
+
+    /*
+    cos(tau * id / n), evaluated at compile time. The angle is reduced to the first octant
+    exactly, in integers, so every entry is accurate to about one unit in the last place.
+    */
+    inline constexpr double constexpr_cos_of_turn_fraction(std::size_t id, std::size_t n) {
+        return (
+            ((8 * (id % n)) <= 4 * n)
+            ? constexpr_cos_first_half(8 * (id % n), n)
+            : constexpr_cos_first_half(8 * n - 8 * (id % n), n)
+        );
+    }
+
+    /*
+    Table of cos over [0, tau], with N_SEGMENTS equal segments, so N_SEGMENTS + 1 entries (the
+    first and last entries are both cos(0)). The table is generated at compile time.
+    */
+    template <typename table_sample_type, std::size_t N_SEGMENTS, typename IdSequenceT = typename make_index_sequence<N_SEGMENTS + 1>::type>
+    struct CosineTable;
+
+    template <typename table_sample_type, std::size_t N_SEGMENTS, std::size_t... IDS>
+    struct CosineTable<table_sample_type, N_SEGMENTS, index_sequence<IDS...>> {
+        static_assert(N_SEGMENTS >= 4, "The table must have at least 4 segments");
+
+        static constexpr std::size_t N_ENTRIES = N_SEGMENTS + 1;
+        static constexpr table_sample_type values[N_ENTRIES] = {
+            table_sample_type(constexpr_cos_of_turn_fraction(IDS, N_SEGMENTS))...
+        };
+    };
+
+    template <typename table_sample_type, std::size_t N_SEGMENTS, std::size_t... IDS>
+    constexpr table_sample_type CosineTable<table_sample_type, N_SEGMENTS, index_sequence<IDS...>>::values[CosineTable<table_sample_type, N_SEGMENTS, index_sequence<IDS...>>::N_ENTRIES];
+}}}
+
+#endif
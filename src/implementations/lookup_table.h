@@ -1,1027 +0,0 @@
-const double lookup_table[1025] = {
-    0x1.0000000000000p+0,
-    0x1.fffd8858e8a92p-1,
-    0x1.fff62169b92dbp-1,
-    0x1.ffe9cb44b51a1p-1,
-    0x1.ffd886084cd0dp-1,
-    0x1.ffc251df1d3f8p-1,
-    0x1.ffa72effef75dp-1,
-    0x1.ff871dadb81dfp-1,
-    0x1.ff621e3796d7ep-1,
-    0x1.ff3830f8d575cp-1,
-    0x1.ff095658e71adp-1,
-    0x1.fed58ecb673c4p-1,
-    0x1.fe9cdad01883ap-1,
-    0x1.fe5f3af2e3940p-1,
-    0x1.fe1cafcbd5b09p-1,
-    0x1.fdd539ff1f456p-1,
-    0x1.fd88da3d12526p-1,
-    0x1.fd37914220b84p-1,
-    0x1.fce15fd6da67bp-1,
-    0x1.fc8646cfeb721p-1,
-    0x1.fc26470e19fd3p-1,
-    0x1.fbc1617e44186p-1,
-    0x1.fb5797195d741p-1,
-    0x1.fae8e8e46cfbbp-1,
-    0x1.fa7557f08a517p-1,
-    0x1.f9fce55adb2c8p-1,
-    0x1.f97f924c9099bp-1,
-    0x1.f8fd5ffae41dbp-1,
-    0x1.f8764fa714ba9p-1,
-    0x1.f7ea629e63d6ep-1,
-    0x1.f7599a3a12077p-1,
-    0x1.f6c3f7df5bbb7p-1,
-    0x1.f6297cff75cb0p-1,
-    0x1.f58a2b1789e84p-1,
-    0x1.f4e603b0b2f2dp-1,
-    0x1.f43d085ff92ddp-1,
-    0x1.f38f3ac64e589p-1,
-    0x1.f2dc9c9089a9dp-1,
-    0x1.f2252f7763adap-1,
-    0x1.f168f53f7205dp-1,
-    0x1.f0a7efb9230d7p-1,
-    0x1.efe220c0b95edp-1,
-    0x1.ef178a3e473c2p-1,
-    0x1.ee482e25a9dbcp-1,
-    0x1.ed740e7684963p-1,
-    0x1.ec9b2d3c3bf84p-1,
-    0x1.ebbd8c8df0b74p-1,
-    0x1.eadb2e8e7a88ep-1,
-    0x1.e9f4156c62ddap-1,
-    0x1.e9084361df7f3p-1,
-    0x1.e817bab4cd10dp-1,
-    0x1.e7227db6a9744p-1,
-    0x1.e6288ec48e112p-1,
-    0x1.e529f04729ffcp-1,
-    0x1.e426a4b2bc17ep-1,
-    0x1.e31eae870ce25p-1,
-    0x1.e212104f686e5p-1,
-    0x1.e100cca2980acp-1,
-    0x1.dfeae622dbe2bp-1,
-    0x1.ded05f7de47dap-1,
-    0x1.ddb13b6ccc23dp-1,
-    0x1.dc8d7cb410260p-1,
-    0x1.db6526238a09bp-1,
-    0x1.da383a9668988p-1,
-    0x1.d906bcf328d46p-1,
-    0x1.d7d0b02b8ecf9p-1,
-    0x1.d696173c9e68bp-1,
-    0x1.d556f52e93eb1p-1,
-    0x1.d4134d14dc93ap-1,
-    0x1.d2cb220e0ef9fp-1,
-    0x1.d17e7743e35dcp-1,
-    0x1.d02d4feb2bd92p-1,
-    0x1.ced7af43cc773p-1,
-    0x1.cd7d9898b32f6p-1,
-    0x1.cc1f0f3fcfc5cp-1,
-    0x1.cabc169a0b901p-1,
-    0x1.c954b213411f5p-1,
-    0x1.c7e8e52233cf3p-1,
-    0x1.c678b3488739bp-1,
-    0x1.c5042012b6907p-1,
-    0x1.c38b2f180bdb1p-1,
-    0x1.c20de3fa971b0p-1,
-    0x1.c08c426725549p-1,
-    0x1.bf064e15377ddp-1,
-    0x1.bd7c0ac6f952ap-1,
-    0x1.bbed7c49380eap-1,
-    0x1.ba5aa673590d2p-1,
-    0x1.b8c38d27504e9p-1,
-    0x1.b728345196e3ep-1,
-    0x1.b5889fe921405p-1,
-    0x1.b3e4d3ef55712p-1,
-    0x1.b23cd470013b4p-1,
-    0x1.b090a58150200p-1,
-    0x1.aee04b43c1474p-1,
-    0x1.ad2bc9e21d511p-1,
-    0x1.ab7325916c0d4p-1,
-    0x1.a9b66290ea1a3p-1,
-    0x1.a7f58529fe69dp-1,
-    0x1.a63091b02fae2p-1,
-    0x1.a4678c8119ac8p-1,
-    0x1.a29a7a0462782p-1,
-    0x1.a0c95eabaf937p-1,
-    0x1.9ef43ef29af94p-1,
-    0x1.9d1b1f5ea80d6p-1,
-    0x1.9b3e047f38741p-1,
-    0x1.995cf2ed80d22p-1,
-    0x1.9777ef4c7d742p-1,
-    0x1.958efe48e6dd7p-1,
-    0x1.93a22499263fbp-1,
-    0x1.91b166fd49da2p-1,
-    0x1.8fbcca3ef940dp-1,
-    0x1.8dc45331698ccp-1,
-    0x1.8bc806b151741p-1,
-    0x1.89c7e9a4dd4abp-1,
-    0x1.87c400fba2ebfp-1,
-    0x1.85bc51ae958ccp-1,
-    0x1.83b0e0bff976ep-1,
-    0x1.81a1b33b57accp-1,
-    0x1.7f8ece3571771p-1,
-    0x1.7d7836cc33db2p-1,
-    0x1.7b5df226aafb0p-1,
-    0x1.79400574f55e4p-1,
-    0x1.771e75f037261p-1,
-    0x1.74f948da8d28dp-1,
-    0x1.72d0837efff97p-1,
-    0x1.70a42b3176d7ap-1,
-    0x1.6e74454eaa8afp-1,
-    0x1.6c40d73c18275p-1,
-    0x1.6a09e667f3bcdp-1,
-    0x1.67cf78491af10p-1,
-    0x1.6591925f0783ep-1,
-    0x1.63503a31c1be9p-1,
-    0x1.610b7551d2cdfp-1,
-    0x1.5ec3495837074p-1,
-    0x1.5c77bbe65018cp-1,
-    0x1.5a28d2a5d7251p-1,
-    0x1.57d69348cec9fp-1,
-    0x1.5581038975137p-1,
-    0x1.5328292a35596p-1,
-    0x1.50cc09f59a09cp-1,
-    0x1.4e6cabbe3e5eap-1,
-    0x1.4c0a145ec0005p-1,
-    0x1.49a449b9b0939p-1,
-    0x1.473b51b987347p-1,
-    0x1.44cf325091dd6p-1,
-    0x1.425ff178e6bb2p-1,
-    0x1.3fed9534556d5p-1,
-    0x1.3d78238c58344p-1,
-    0x1.3affa292050b9p-1,
-    0x1.3884185dfeb22p-1,
-    0x1.36058b10659f3p-1,
-    0x1.338400d0c8e57p-1,
-    0x1.30ff7fce17036p-1,
-    0x1.2e780e3e8ea17p-1,
-    0x1.2bedb25faf3eap-1,
-    0x1.2960727629ca8p-1,
-    0x1.26d054cdd12dfp-1,
-    0x1.243d5fb98ac20p-1,
-    0x1.21a799933eb59p-1,
-    0x1.1f0f08bbc861bp-1,
-    0x1.1c73b39ae68c9p-1,
-    0x1.19d5a09f2b9b8p-1,
-    0x1.1734d63dedb49p-1,
-    0x1.14915af336cecp-1,
-    0x1.11eb3541b4b23p-1,
-    0x1.0f426bb2a8e7fp-1,
-    0x1.0c9704d5d898ep-1,
-    0x1.09e907417c5e0p-1,
-    0x1.073879922ffedp-1,
-    0x1.0485626ae221ap-1,
-    0x1.01cfc874c3eb7p-1,
-    0x1.fe2f64be71210p-2,
-    0x1.f8ba4dbf89abbp-2,
-    0x1.f3405963fd069p-2,
-    0x1.edc1952ef78d7p-2,
-    0x1.e83e0eaf85116p-2,
-    0x1.e2b5d3806f63ep-2,
-    0x1.dd28f1481cc57p-2,
-    0x1.d79775b86e389p-2,
-    0x1.d2016e8e9db5bp-2,
-    0x1.cc66e9931c45ep-2,
-    0x1.c6c7f4997000bp-2,
-    0x1.c1249d8011ee8p-2,
-    0x1.bb7cf2304bd02p-2,
-    0x1.b5d1009e15cc2p-2,
-    0x1.b020d6c7f400bp-2,
-    0x1.aa6c82b6d3fccp-2,
-    0x1.a4b4127dea1e4p-2,
-    0x1.9ef7943a8ed8ap-2,
-    0x1.993716141bdfep-2,
-    0x1.9372a63bc93d7p-2,
-    0x1.8daa52ec8a4b0p-2,
-    0x1.87de2a6aea964p-2,
-    0x1.820e3b04eaac5p-2,
-    0x1.7c3a9311dcce8p-2,
-    0x1.766340f2418f8p-2,
-    0x1.7088530fa45a1p-2,
-    0x1.6aa9d7dc77e19p-2,
-    0x1.64c7ddd3f27c5p-2,
-    0x1.5ee27379ea693p-2,
-    0x1.58f9a75ab1fddp-2,
-    0x1.530d880af3c24p-2,
-    0x1.4d1e24278e76bp-2,
-    0x1.472b8a5571055p-2,
-    0x1.4135c94176603p-2,
-    0x1.3b3cefa0414b9p-2,
-    0x1.35410c2e18154p-2,
-    0x1.2f422daec0389p-2,
-    0x1.294062ed59f05p-2,
-    0x1.233bbabc3bb71p-2,
-    0x1.1d3443f4cdb3dp-2,
-    0x1.172a0d7765177p-2,
-    0x1.111d262b1f678p-2,
-    0x1.0b0d9cfdbdb91p-2,
-    0x1.04fb80e37fdafp-2,
-    0x1.fdcdc1adfedfcp-3,
-    0x1.f19f97b215f1ep-3,
-    0x1.e56ca1e101a20p-3,
-    0x1.d934fe5454317p-3,
-    0x1.ccf8cb312b284p-3,
-    0x1.c0b826a7e4f62p-3,
-    0x1.b4732ef3d6722p-3,
-    0x1.a82a025b00451p-3,
-    0x1.9bdcbf2dc4368p-3,
-    0x1.8f8b83c69a60dp-3,
-    0x1.83366e89c64c8p-3,
-    0x1.76dd9de50bf35p-3,
-    0x1.6a81304f64ab6p-3,
-    0x1.5e214448b3fcbp-3,
-    0x1.51bdf8597c5f8p-3,
-    0x1.45576b1293e58p-3,
-    0x1.38edbb0cd8d13p-3,
-    0x1.2c8106e8e613ap-3,
-    0x1.20116d4ec7bcfp-3,
-    0x1.139f0cedaf578p-3,
-    0x1.072a047ba831fp-3,
-    0x1.f564e56a97314p-4,
-    0x1.dc70ecbae9fd1p-4,
-    0x1.c3785c79ec2dep-4,
-    0x1.aa7b724495c0ep-4,
-    0x1.917a6bc29b438p-4,
-    0x1.787586a5d5b1fp-4,
-    0x1.5f6d00a9aa418p-4,
-    0x1.4661179272096p-4,
-    0x1.2d52092ce19f8p-4,
-    0x1.1440134d709b6p-4,
-    0x1.f656e79f820eap-5,
-    0x1.c428d12c0d7f0p-5,
-    0x1.91f65f10dd824p-5,
-    0x1.5fc00d290cd57p-5,
-    0x1.2d865759455e4p-5,
-    0x1.f693731d1cef4p-6,
-    0x1.92155f7a36677p-6,
-    0x1.2d936bbe30efdp-6,
-    0x1.921d1fcdec78fp-7,
-    0x1.921f0fe67009fp-8,
-    0x1.1a62633145c07p-54,
-    -0x1.921f0fe670012p-8,
-    -0x1.921d1fcdec749p-7,
-    -0x1.2d936bbe30ed9p-6,
-    -0x1.92155f7a36654p-6,
-    -0x1.f693731d1ced1p-6,
-    -0x1.2d865759455d2p-5,
-    -0x1.5fc00d290cd45p-5,
-    -0x1.91f65f10dd813p-5,
-    -0x1.c428d12c0d7dfp-5,
-    -0x1.f656e79f820d9p-5,
-    -0x1.1440134d709adp-4,
-    -0x1.2d52092ce19efp-4,
-    -0x1.466117927208ep-4,
-    -0x1.5f6d00a9aa40fp-4,
-    -0x1.787586a5d5b16p-4,
-    -0x1.917a6bc29b42fp-4,
-    -0x1.aa7b724495c05p-4,
-    -0x1.c3785c79ec2d5p-4,
-    -0x1.dc70ecbae9fc8p-4,
-    -0x1.f564e56a9730bp-4,
-    -0x1.072a047ba831bp-3,
-    -0x1.139f0cedaf574p-3,
-    -0x1.20116d4ec7bcbp-3,
-    -0x1.2c8106e8e6136p-3,
-    -0x1.38edbb0cd8d0fp-3,
-    -0x1.45576b1293e54p-3,
-    -0x1.51bdf8597c5f3p-3,
-    -0x1.5e214448b3fc7p-3,
-    -0x1.6a81304f64ab2p-3,
-    -0x1.76dd9de50bf30p-3,
-    -0x1.83366e89c64c4p-3,
-    -0x1.8f8b83c69a608p-3,
-    -0x1.9bdcbf2dc4363p-3,
-    -0x1.a82a025b0044dp-3,
-    -0x1.b4732ef3d671ep-3,
-    -0x1.c0b826a7e4f5ep-3,
-    -0x1.ccf8cb312b280p-3,
-    -0x1.d934fe5454312p-3,
-    -0x1.e56ca1e101a1cp-3,
-    -0x1.f19f97b215f1ap-3,
-    -0x1.fdcdc1adfedf7p-3,
-    -0x1.04fb80e37fdadp-2,
-    -0x1.0b0d9cfdbdb8fp-2,
-    -0x1.111d262b1f676p-2,
-    -0x1.172a0d7765175p-2,
-    -0x1.1d3443f4cdb3bp-2,
-    -0x1.233bbabc3bb6fp-2,
-    -0x1.294062ed59f02p-2,
-    -0x1.2f422daec0387p-2,
-    -0x1.35410c2e18152p-2,
-    -0x1.3b3cefa0414b7p-2,
-    -0x1.4135c94176600p-2,
-    -0x1.472b8a5571053p-2,
-    -0x1.4d1e24278e769p-2,
-    -0x1.530d880af3c22p-2,
-    -0x1.58f9a75ab1fdbp-2,
-    -0x1.5ee27379ea691p-2,
-    -0x1.64c7ddd3f27c3p-2,
-    -0x1.6aa9d7dc77e17p-2,
-    -0x1.7088530fa459fp-2,
-    -0x1.766340f2418f6p-2,
-    -0x1.7c3a9311dcce6p-2,
-    -0x1.820e3b04eaac3p-2,
-    -0x1.87de2a6aea962p-2,
-    -0x1.8daa52ec8a4aep-2,
-    -0x1.9372a63bc93d5p-2,
-    -0x1.993716141bdfcp-2,
-    -0x1.9ef7943a8ed88p-2,
-    -0x1.a4b4127dea1e2p-2,
-    -0x1.aa6c82b6d3fc6p-2,
-    -0x1.b020d6c7f4009p-2,
-    -0x1.b5d1009e15cbcp-2,
-    -0x1.bb7cf2304bd00p-2,
-    -0x1.c1249d8011ee2p-2,
-    -0x1.c6c7f49970009p-2,
-    -0x1.cc66e9931c460p-2,
-    -0x1.d2016e8e9db59p-2,
-    -0x1.d79775b86e38ap-2,
-    -0x1.dd28f1481cc55p-2,
-    -0x1.e2b5d3806f63cp-2,
-    -0x1.e83e0eaf85110p-2,
-    -0x1.edc1952ef78d5p-2,
-    -0x1.f3405963fd063p-2,
-    -0x1.f8ba4dbf89ab9p-2,
-    -0x1.fe2f64be7120bp-2,
-    -0x1.01cfc874c3eb6p-1,
-    -0x1.0485626ae221bp-1,
-    -0x1.073879922ffecp-1,
-    -0x1.09e907417c5e1p-1,
-    -0x1.0c9704d5d898dp-1,
-    -0x1.0f426bb2a8e7ep-1,
-    -0x1.11eb3541b4b21p-1,
-    -0x1.14915af336cebp-1,
-    -0x1.1734d63dedb47p-1,
-    -0x1.19d5a09f2b9b7p-1,
-    -0x1.1c73b39ae68c6p-1,
-    -0x1.1f0f08bbc861ap-1,
-    -0x1.21a799933eb59p-1,
-    -0x1.243d5fb98ac1ep-1,
-    -0x1.26d054cdd12dfp-1,
-    -0x1.2960727629ca7p-1,
-    -0x1.2bedb25faf3eap-1,
-    -0x1.2e780e3e8ea15p-1,
-    -0x1.30ff7fce17035p-1,
-    -0x1.338400d0c8e55p-1,
-    -0x1.36058b10659f2p-1,
-    -0x1.3884185dfeb23p-1,
-    -0x1.3affa292050b8p-1,
-    -0x1.3d78238c58344p-1,
-    -0x1.3fed9534556d3p-1,
-    -0x1.425ff178e6bb2p-1,
-    -0x1.44cf325091dd5p-1,
-    -0x1.473b51b987347p-1,
-    -0x1.49a449b9b0937p-1,
-    -0x1.4c0a145ec0004p-1,
-    -0x1.4e6cabbe3e5e7p-1,
-    -0x1.50cc09f59a09ap-1,
-    -0x1.5328292a35597p-1,
-    -0x1.5581038975136p-1,
-    -0x1.57d69348ceca0p-1,
-    -0x1.5a28d2a5d724fp-1,
-    -0x1.5c77bbe65018cp-1,
-    -0x1.5ec3495837073p-1,
-    -0x1.610b7551d2cdfp-1,
-    -0x1.63503a31c1be7p-1,
-    -0x1.6591925f0783dp-1,
-    -0x1.67cf78491af0ep-1,
-    -0x1.6a09e667f3bccp-1,
-    -0x1.6c40d73c18276p-1,
-    -0x1.6e74454eaa8aep-1,
-    -0x1.70a42b3176d7ap-1,
-    -0x1.72d0837efff95p-1,
-    -0x1.74f948da8d28dp-1,
-    -0x1.771e75f037260p-1,
-    -0x1.79400574f55e4p-1,
-    -0x1.7b5df226aafadp-1,
-    -0x1.7d7836cc33db2p-1,
-    -0x1.7f8ece357176fp-1,
-    -0x1.81a1b33b57acbp-1,
-    -0x1.83b0e0bff976fp-1,
-    -0x1.85bc51ae958cbp-1,
-    -0x1.87c400fba2ebfp-1,
-    -0x1.89c7e9a4dd4a9p-1,
-    -0x1.8bc806b151741p-1,
-    -0x1.8dc45331698cbp-1,
-    -0x1.8fbcca3ef940dp-1,
-    -0x1.91b166fd49da0p-1,
-    -0x1.93a22499263fbp-1,
-    -0x1.958efe48e6dd5p-1,
-    -0x1.9777ef4c7d741p-1,
-    -0x1.995cf2ed80d23p-1,
-    -0x1.9b3e047f38740p-1,
-    -0x1.9d1b1f5ea80d6p-1,
-    -0x1.9ef43ef29af93p-1,
-    -0x1.a0c95eabaf937p-1,
-    -0x1.a29a7a0462781p-1,
-    -0x1.a4678c8119ac8p-1,
-    -0x1.a63091b02fae0p-1,
-    -0x1.a7f58529fe69cp-1,
-    -0x1.a9b66290ea1a4p-1,
-    -0x1.ab7325916c0d4p-1,
-    -0x1.ad2bc9e21d511p-1,
-    -0x1.aee04b43c1473p-1,
-    -0x1.b090a58150200p-1,
-    -0x1.b23cd470013b3p-1,
-    -0x1.b3e4d3ef55712p-1,
-    -0x1.b5889fe921404p-1,
-    -0x1.b728345196e3dp-1,
-    -0x1.b8c38d27504e8p-1,
-    -0x1.ba5aa673590d2p-1,
-    -0x1.bbed7c49380eap-1,
-    -0x1.bd7c0ac6f9529p-1,
-    -0x1.bf064e15377ddp-1,
-    -0x1.c08c426725548p-1,
-    -0x1.c20de3fa971b0p-1,
-    -0x1.c38b2f180bdb0p-1,
-    -0x1.c5042012b6907p-1,
-    -0x1.c678b3488739ap-1,
-    -0x1.c7e8e52233cf3p-1,
-    -0x1.c954b213411f4p-1,
-    -0x1.cabc169a0b900p-1,
-    -0x1.cc1f0f3fcfc5dp-1,
-    -0x1.cd7d9898b32f5p-1,
-    -0x1.ced7af43cc773p-1,
-    -0x1.d02d4feb2bd92p-1,
-    -0x1.d17e7743e35dcp-1,
-    -0x1.d2cb220e0ef9ep-1,
-    -0x1.d4134d14dc93ap-1,
-    -0x1.d556f52e93eb0p-1,
-    -0x1.d696173c9e68bp-1,
-    -0x1.d7d0b02b8ecf8p-1,
-    -0x1.d906bcf328d46p-1,
-    -0x1.da383a9668988p-1,
-    -0x1.db6526238a09ap-1,
-    -0x1.dc8d7cb410260p-1,
-    -0x1.ddb13b6ccc23cp-1,
-    -0x1.ded05f7de47dap-1,
-    -0x1.dfeae622dbe2ap-1,
-    -0x1.e100cca2980acp-1,
-    -0x1.e212104f686e4p-1,
-    -0x1.e31eae870ce25p-1,
-    -0x1.e426a4b2bc17dp-1,
-    -0x1.e529f04729ffcp-1,
-    -0x1.e6288ec48e112p-1,
-    -0x1.e7227db6a9744p-1,
-    -0x1.e817bab4cd10dp-1,
-    -0x1.e9084361df7f2p-1,
-    -0x1.e9f4156c62ddap-1,
-    -0x1.eadb2e8e7a88dp-1,
-    -0x1.ebbd8c8df0b74p-1,
-    -0x1.ec9b2d3c3bf83p-1,
-    -0x1.ed740e7684963p-1,
-    -0x1.ee482e25a9dbbp-1,
-    -0x1.ef178a3e473c2p-1,
-    -0x1.efe220c0b95edp-1,
-    -0x1.f0a7efb9230d7p-1,
-    -0x1.f168f53f7205dp-1,
-    -0x1.f2252f7763ad9p-1,
-    -0x1.f2dc9c9089a9dp-1,
-    -0x1.f38f3ac64e588p-1,
-    -0x1.f43d085ff92ddp-1,
-    -0x1.f4e603b0b2f2cp-1,
-    -0x1.f58a2b1789e84p-1,
-    -0x1.f6297cff75cb0p-1,
-    -0x1.f6c3f7df5bbb7p-1,
-    -0x1.f7599a3a12077p-1,
-    -0x1.f7ea629e63d6ep-1,
-    -0x1.f8764fa714ba9p-1,
-    -0x1.f8fd5ffae41dap-1,
-    -0x1.f97f924c9099bp-1,
-    -0x1.f9fce55adb2c8p-1,
-    -0x1.fa7557f08a517p-1,
-    -0x1.fae8e8e46cfbap-1,
-    -0x1.fb5797195d741p-1,
-    -0x1.fbc1617e44186p-1,
-    -0x1.fc26470e19fd3p-1,
-    -0x1.fc8646cfeb721p-1,
-    -0x1.fce15fd6da67bp-1,
-    -0x1.fd37914220b84p-1,
-    -0x1.fd88da3d12525p-1,
-    -0x1.fdd539ff1f456p-1,
-    -0x1.fe1cafcbd5b09p-1,
-    -0x1.fe5f3af2e3940p-1,
-    -0x1.fe9cdad01883ap-1,
-    -0x1.fed58ecb673c4p-1,
-    -0x1.ff095658e71adp-1,
-    -0x1.ff3830f8d575cp-1,
-    -0x1.ff621e3796d7ep-1,
-    -0x1.ff871dadb81dfp-1,
-    -0x1.ffa72effef75dp-1,
-    -0x1.ffc251df1d3f8p-1,
-    -0x1.ffd886084cd0dp-1,
-    -0x1.ffe9cb44b51a1p-1,
-    -0x1.fff62169b92dbp-1,
-    -0x1.fffd8858e8a92p-1,
-    -0x1.0000000000000p+0,
-    -0x1.fffd8858e8a92p-1,
-    -0x1.fff62169b92dbp-1,
-    -0x1.ffe9cb44b51a1p-1,
-    -0x1.ffd886084cd0dp-1,
-    -0x1.ffc251df1d3f8p-1,
-    -0x1.ffa72effef75dp-1,
-    -0x1.ff871dadb81dfp-1,
-    -0x1.ff621e3796d7ep-1,
-    -0x1.ff3830f8d575cp-1,
-    -0x1.ff095658e71adp-1,
-    -0x1.fed58ecb673c4p-1,
-    -0x1.fe9cdad01883ap-1,
-    -0x1.fe5f3af2e3941p-1,
-    -0x1.fe1cafcbd5b09p-1,
-    -0x1.fdd539ff1f456p-1,
-    -0x1.fd88da3d12526p-1,
-    -0x1.fd37914220b85p-1,
-    -0x1.fce15fd6da67bp-1,
-    -0x1.fc8646cfeb722p-1,
-    -0x1.fc26470e19fd3p-1,
-    -0x1.fbc1617e44186p-1,
-    -0x1.fb5797195d741p-1,
-    -0x1.fae8e8e46cfbbp-1,
-    -0x1.fa7557f08a517p-1,
-    -0x1.f9fce55adb2c8p-1,
-    -0x1.f97f924c9099bp-1,
-    -0x1.f8fd5ffae41dbp-1,
-    -0x1.f8764fa714baap-1,
-    -0x1.f7ea629e63d6fp-1,
-    -0x1.f7599a3a12078p-1,
-    -0x1.f6c3f7df5bbb7p-1,
-    -0x1.f6297cff75cb0p-1,
-    -0x1.f58a2b1789e84p-1,
-    -0x1.f4e603b0b2f2dp-1,
-    -0x1.f43d085ff92ddp-1,
-    -0x1.f38f3ac64e589p-1,
-    -0x1.f2dc9c9089a9dp-1,
-    -0x1.f2252f7763adap-1,
-    -0x1.f168f53f7205ep-1,
-    -0x1.f0a7efb9230d7p-1,
-    -0x1.efe220c0b95edp-1,
-    -0x1.ef178a3e473c3p-1,
-    -0x1.ee482e25a9dbcp-1,
-    -0x1.ed740e7684964p-1,
-    -0x1.ec9b2d3c3bf84p-1,
-    -0x1.ebbd8c8df0b75p-1,
-    -0x1.eadb2e8e7a88ep-1,
-    -0x1.e9f4156c62ddbp-1,
-    -0x1.e9084361df7f3p-1,
-    -0x1.e817bab4cd10ep-1,
-    -0x1.e7227db6a9744p-1,
-    -0x1.e6288ec48e113p-1,
-    -0x1.e529f04729ffdp-1,
-    -0x1.e426a4b2bc17ep-1,
-    -0x1.e31eae870ce25p-1,
-    -0x1.e212104f686e5p-1,
-    -0x1.e100cca2980adp-1,
-    -0x1.dfeae622dbe2bp-1,
-    -0x1.ded05f7de47dbp-1,
-    -0x1.ddb13b6ccc23dp-1,
-    -0x1.dc8d7cb410261p-1,
-    -0x1.db6526238a09bp-1,
-    -0x1.da383a9668989p-1,
-    -0x1.d906bcf328d47p-1,
-    -0x1.d7d0b02b8ecf9p-1,
-    -0x1.d696173c9e68bp-1,
-    -0x1.d556f52e93eb1p-1,
-    -0x1.d4134d14dc93ap-1,
-    -0x1.d2cb220e0ef9fp-1,
-    -0x1.d17e7743e35ddp-1,
-    -0x1.d02d4feb2bd93p-1,
-    -0x1.ced7af43cc774p-1,
-    -0x1.cd7d9898b32f6p-1,
-    -0x1.cc1f0f3fcfc5ep-1,
-    -0x1.cabc169a0b901p-1,
-    -0x1.c954b213411f5p-1,
-    -0x1.c7e8e52233cf4p-1,
-    -0x1.c678b3488739bp-1,
-    -0x1.c5042012b6908p-1,
-    -0x1.c38b2f180bdb1p-1,
-    -0x1.c20de3fa971b1p-1,
-    -0x1.c08c426725549p-1,
-    -0x1.bf064e15377dep-1,
-    -0x1.bd7c0ac6f952ap-1,
-    -0x1.bbed7c49380ecp-1,
-    -0x1.ba5aa673590d3p-1,
-    -0x1.b8c38d27504e9p-1,
-    -0x1.b728345196e3ep-1,
-    -0x1.b5889fe921405p-1,
-    -0x1.b3e4d3ef55713p-1,
-    -0x1.b23cd470013b4p-1,
-    -0x1.b090a58150201p-1,
-    -0x1.aee04b43c1474p-1,
-    -0x1.ad2bc9e21d512p-1,
-    -0x1.ab7325916c0d5p-1,
-    -0x1.a9b66290ea1a5p-1,
-    -0x1.a7f58529fe69ep-1,
-    -0x1.a63091b02fae2p-1,
-    -0x1.a4678c8119ac9p-1,
-    -0x1.a29a7a0462782p-1,
-    -0x1.a0c95eabaf938p-1,
-    -0x1.9ef43ef29af95p-1,
-    -0x1.9d1b1f5ea80d7p-1,
-    -0x1.9b3e047f38741p-1,
-    -0x1.995cf2ed80d24p-1,
-    -0x1.9777ef4c7d742p-1,
-    -0x1.958efe48e6dd6p-1,
-    -0x1.93a22499263fcp-1,
-    -0x1.91b166fd49da2p-1,
-    -0x1.8fbcca3ef940ep-1,
-    -0x1.8dc45331698ccp-1,
-    -0x1.8bc806b151742p-1,
-    -0x1.89c7e9a4dd4abp-1,
-    -0x1.87c400fba2ec0p-1,
-    -0x1.85bc51ae958cdp-1,
-    -0x1.83b0e0bff9770p-1,
-    -0x1.81a1b33b57accp-1,
-    -0x1.7f8ece3571770p-1,
-    -0x1.7d7836cc33db3p-1,
-    -0x1.7b5df226aafafp-1,
-    -0x1.79400574f55e6p-1,
-    -0x1.771e75f037261p-1,
-    -0x1.74f948da8d28fp-1,
-    -0x1.72d0837efff97p-1,
-    -0x1.70a42b3176d7cp-1,
-    -0x1.6e74454eaa8afp-1,
-    -0x1.6c40d73c18277p-1,
-    -0x1.6a09e667f3bcep-1,
-    -0x1.67cf78491af10p-1,
-    -0x1.6591925f0783fp-1,
-    -0x1.63503a31c1be9p-1,
-    -0x1.610b7551d2ce0p-1,
-    -0x1.5ec3495837074p-1,
-    -0x1.5c77bbe65018ep-1,
-    -0x1.5a28d2a5d7251p-1,
-    -0x1.57d69348ceca2p-1,
-    -0x1.5581038975138p-1,
-    -0x1.5328292a35598p-1,
-    -0x1.50cc09f59a09cp-1,
-    -0x1.4e6cabbe3e5ecp-1,
-    -0x1.4c0a145ec0002p-1,
-    -0x1.49a449b9b0939p-1,
-    -0x1.473b51b987349p-1,
-    -0x1.44cf325091ddap-1,
-    -0x1.425ff178e6bb0p-1,
-    -0x1.3fed9534556d5p-1,
-    -0x1.3d78238c58346p-1,
-    -0x1.3affa292050bdp-1,
-    -0x1.3884185dfeb21p-1,
-    -0x1.36058b10659f4p-1,
-    -0x1.338400d0c8e5ap-1,
-    -0x1.30ff7fce17033p-1,
-    -0x1.2e780e3e8ea17p-1,
-    -0x1.2bedb25faf3ecp-1,
-    -0x1.2960727629cacp-1,
-    -0x1.26d054cdd12dep-1,
-    -0x1.243d5fb98ac20p-1,
-    -0x1.21a799933eb5bp-1,
-    -0x1.1f0f08bbc861fp-1,
-    -0x1.1c73b39ae68c8p-1,
-    -0x1.19d5a09f2b9b9p-1,
-    -0x1.1734d63dedb4cp-1,
-    -0x1.14915af336ceap-1,
-    -0x1.11eb3541b4b23p-1,
-    -0x1.0f426bb2a8e80p-1,
-    -0x1.0c9704d5d8992p-1,
-    -0x1.09e907417c5dfp-1,
-    -0x1.073879922ffeep-1,
-    -0x1.0485626ae221dp-1,
-    -0x1.01cfc874c3ebbp-1,
-    -0x1.fe2f64be7120fp-2,
-    -0x1.f8ba4dbf89abdp-2,
-    -0x1.f3405963fd06ep-2,
-    -0x1.edc1952ef78d2p-2,
-    -0x1.e83e0eaf85114p-2,
-    -0x1.e2b5d3806f63fp-2,
-    -0x1.dd28f1481cc60p-2,
-    -0x1.d79775b86e387p-2,
-    -0x1.d2016e8e9db5dp-2,
-    -0x1.cc66e9931c464p-2,
-    -0x1.c6c7f49970014p-2,
-    -0x1.c1249d8011ee6p-2,
-    -0x1.bb7cf2304bd04p-2,
-    -0x1.b5d1009e15cc7p-2,
-    -0x1.b020d6c7f4006p-2,
-    -0x1.aa6c82b6d3fcap-2,
-    -0x1.a4b4127dea1e9p-2,
-    -0x1.9ef7943a8ed93p-2,
-    -0x1.993716141bdfdp-2,
-    -0x1.9372a63bc93d9p-2,
-    -0x1.8daa52ec8a4b6p-2,
-    -0x1.87de2a6aea96dp-2,
-    -0x1.820e3b04eaac3p-2,
-    -0x1.7c3a9311dccebp-2,
-    -0x1.766340f2418fep-2,
-    -0x1.7088530fa459bp-2,
-    -0x1.6aa9d7dc77e18p-2,
-    -0x1.64c7ddd3f27cbp-2,
-    -0x1.5ee27379ea69cp-2,
-    -0x1.58f9a75ab1fdbp-2,
-    -0x1.530d880af3c26p-2,
-    -0x1.4d1e24278e771p-2,
-    -0x1.472b8a557104fp-2,
-    -0x1.4135c94176601p-2,
-    -0x1.3b3cefa0414bbp-2,
-    -0x1.35410c2e1815ap-2,
-    -0x1.2f422daec0384p-2,
-    -0x1.294062ed59f07p-2,
-    -0x1.233bbabc3bb77p-2,
-    -0x1.1d3443f4cdb47p-2,
-    -0x1.172a0d7765175p-2,
-    -0x1.111d262b1f67ap-2,
-    -0x1.0b0d9cfdbdb97p-2,
-    -0x1.04fb80e37fdaap-2,
-    -0x1.fdcdc1adfedf8p-3,
-    -0x1.f19f97b215f23p-3,
-    -0x1.e56ca1e101a2cp-3,
-    -0x1.d934fe545430bp-3,
-    -0x1.ccf8cb312b289p-3,
-    -0x1.c0b826a7e4f6ep-3,
-    -0x1.b4732ef3d6736p-3,
-    -0x1.a82a025b0044ep-3,
-    -0x1.9bdcbf2dc436cp-3,
-    -0x1.8f8b83c69a619p-3,
-    -0x1.83366e89c64bdp-3,
-    -0x1.76dd9de50bf31p-3,
-    -0x1.6a81304f64abbp-3,
-    -0x1.5e214448b3fd7p-3,
-    -0x1.51bdf8597c5ecp-3,
-    -0x1.45576b1293e5dp-3,
-    -0x1.38edbb0cd8d1fp-3,
-    -0x1.2c8106e8e614ep-3,
-    -0x1.20116d4ec7bccp-3,
-    -0x1.139f0cedaf57dp-3,
-    -0x1.072a047ba832cp-3,
-    -0x1.f564e56a972fdp-4,
-    -0x1.dc70ecbae9fc9p-4,
-    -0x1.c3785c79ec2e7p-4,
-    -0x1.aa7b724495c27p-4,
-    -0x1.917a6bc29b421p-4,
-    -0x1.787586a5d5b28p-4,
-    -0x1.5f6d00a9aa431p-4,
-    -0x1.46611792720bfp-4,
-    -0x1.2d52092ce19f1p-4,
-    -0x1.1440134d709bfp-4,
-    -0x1.f656e79f8211cp-5,
-    -0x1.c428d12c0d7c2p-5,
-    -0x1.91f65f10dd816p-5,
-    -0x1.5fc00d290cd69p-5,
-    -0x1.2d86575945615p-5,
-    -0x1.f693731d1ced8p-6,
-    -0x1.92155f7a3669bp-6,
-    -0x1.2d936bbe30f60p-6,
-    -0x1.921d1fcdec8d6p-7,
-    -0x1.921f0fe67002dp-8,
-    -0x1.a79394c9e8a0ap-53,
-    0x1.921f0fe66fe85p-8,
-    0x1.921d1fcdec802p-7,
-    0x1.2d936bbe30ef6p-6,
-    0x1.92155f7a36631p-6,
-    0x1.f693731d1ce6ep-6,
-    0x1.2d865759455e0p-5,
-    0x1.5fc00d290cd34p-5,
-    0x1.91f65f10dd7e1p-5,
-    0x1.c428d12c0d78dp-5,
-    0x1.f656e79f820e7p-5,
-    0x1.1440134d709a5p-4,
-    0x1.2d52092ce19d6p-4,
-    0x1.46611792720a5p-4,
-    0x1.5f6d00a9aa416p-4,
-    0x1.787586a5d5b0dp-4,
-    0x1.917a6bc29b407p-4,
-    0x1.aa7b724495c0cp-4,
-    0x1.c3785c79ec2ccp-4,
-    0x1.dc70ecbae9fafp-4,
-    0x1.f564e56a972e3p-4,
-    0x1.072a047ba831fp-3,
-    0x1.139f0cedaf56fp-3,
-    0x1.20116d4ec7bbfp-3,
-    0x1.2c8106e8e6141p-3,
-    0x1.38edbb0cd8d12p-3,
-    0x1.45576b1293e50p-3,
-    0x1.51bdf8597c5dfp-3,
-    0x1.5e214448b3fcap-3,
-    0x1.6a81304f64aaep-3,
-    0x1.76dd9de50bf24p-3,
-    0x1.83366e89c64b0p-3,
-    0x1.8f8b83c69a60cp-3,
-    0x1.9bdcbf2dc435fp-3,
-    0x1.a82a025b00441p-3,
-    0x1.b4732ef3d6729p-3,
-    0x1.c0b826a7e4f61p-3,
-    0x1.ccf8cb312b27cp-3,
-    0x1.d934fe54542fep-3,
-    0x1.e56ca1e101a1fp-3,
-    0x1.f19f97b215f16p-3,
-    0x1.fdcdc1adfedebp-3,
-    0x1.04fb80e37fda3p-2,
-    0x1.0b0d9cfdbdb90p-2,
-    0x1.111d262b1f674p-2,
-    0x1.172a0d776516fp-2,
-    0x1.1d3443f4cdb41p-2,
-    0x1.233bbabc3bb70p-2,
-    0x1.294062ed59f00p-2,
-    0x1.2f422daec037dp-2,
-    0x1.35410c2e18153p-2,
-    0x1.3b3cefa0414b5p-2,
-    0x1.4135c941765fbp-2,
-    0x1.472b8a5571049p-2,
-    0x1.4d1e24278e76ap-2,
-    0x1.530d880af3c20p-2,
-    0x1.58f9a75ab1fd5p-2,
-    0x1.5ee27379ea696p-2,
-    0x1.64c7ddd3f27c5p-2,
-    0x1.6aa9d7dc77e11p-2,
-    0x1.7088530fa4595p-2,
-    0x1.766340f2418f8p-2,
-    0x1.7c3a9311dcce4p-2,
-    0x1.820e3b04eaabdp-2,
-    0x1.87de2a6aea967p-2,
-    0x1.8daa52ec8a4b0p-2,
-    0x1.9372a63bc93d3p-2,
-    0x1.993716141bdf7p-2,
-    0x1.9ef7943a8ed8dp-2,
-    0x1.a4b4127dea1e3p-2,
-    0x1.aa6c82b6d3fc4p-2,
-    0x1.b020d6c7f4000p-2,
-    0x1.b5d1009e15cc1p-2,
-    0x1.bb7cf2304bcfep-2,
-    0x1.c1249d8011ee0p-2,
-    0x1.c6c7f4997000ep-2,
-    0x1.cc66e9931c45ep-2,
-    0x1.d2016e8e9db57p-2,
-    0x1.d79775b86e381p-2,
-    0x1.dd28f1481cc5ap-2,
-    0x1.e2b5d3806f63ap-2,
-    0x1.e83e0eaf8510ep-2,
-    0x1.edc1952ef78ccp-2,
-    0x1.f3405963fd068p-2,
-    0x1.f8ba4dbf89ab7p-2,
-    0x1.fe2f64be71209p-2,
-    0x1.01cfc874c3eb9p-1,
-    0x1.0485626ae221ap-1,
-    0x1.073879922ffecp-1,
-    0x1.09e907417c5ddp-1,
-    0x1.0c9704d5d8990p-1,
-    0x1.0f426bb2a8e7dp-1,
-    0x1.11eb3541b4b20p-1,
-    0x1.14915af336ce7p-1,
-    0x1.1734d63dedb49p-1,
-    0x1.19d5a09f2b9b6p-1,
-    0x1.1c73b39ae68c5p-1,
-    0x1.1f0f08bbc861cp-1,
-    0x1.21a799933eb58p-1,
-    0x1.243d5fb98ac1dp-1,
-    0x1.26d054cdd12dbp-1,
-    0x1.2960727629ca9p-1,
-    0x1.2bedb25faf3e9p-1,
-    0x1.2e780e3e8ea14p-1,
-    0x1.30ff7fce17030p-1,
-    0x1.338400d0c8e57p-1,
-    0x1.36058b10659f1p-1,
-    0x1.3884185dfeb1fp-1,
-    0x1.3affa292050bbp-1,
-    0x1.3d78238c58344p-1,
-    0x1.3fed9534556d2p-1,
-    0x1.425ff178e6baep-1,
-    0x1.44cf325091dd7p-1,
-    0x1.473b51b987346p-1,
-    0x1.49a449b9b0936p-1,
-    0x1.4c0a145ec0000p-1,
-    0x1.4e6cabbe3e5e9p-1,
-    0x1.50cc09f59a09ap-1,
-    0x1.5328292a35593p-1,
-    0x1.5581038975139p-1,
-    0x1.57d69348cec9fp-1,
-    0x1.5a28d2a5d724ep-1,
-    0x1.5c77bbe650189p-1,
-    0x1.5ec3495837075p-1,
-    0x1.610b7551d2cdep-1,
-    0x1.63503a31c1be6p-1,
-    0x1.6591925f07839p-1,
-    0x1.67cf78491af10p-1,
-    0x1.6a09e667f3bcbp-1,
-    0x1.6c40d73c18272p-1,
-    0x1.6e74454eaa8b0p-1,
-    0x1.70a42b3176d7ap-1,
-    0x1.72d0837efff94p-1,
-    0x1.74f948da8d28ap-1,
-    0x1.771e75f037262p-1,
-    0x1.79400574f55e4p-1,
-    0x1.7b5df226aafadp-1,
-    0x1.7d7836cc33dafp-1,
-    0x1.7f8ece3571771p-1,
-    0x1.81a1b33b57acap-1,
-    0x1.83b0e0bff976bp-1,
-    0x1.85bc51ae958cdp-1,
-    0x1.87c400fba2ebep-1,
-    0x1.89c7e9a4dd4a9p-1,
-    0x1.8bc806b15173dp-1,
-    0x1.8dc45331698cdp-1,
-    0x1.8fbcca3ef940cp-1,
-    0x1.91b166fd49da0p-1,
-    0x1.93a22499263f8p-1,
-    0x1.958efe48e6dd7p-1,
-    0x1.9777ef4c7d740p-1,
-    0x1.995cf2ed80d20p-1,
-    0x1.9b3e047f38742p-1,
-    0x1.9d1b1f5ea80d5p-1,
-    0x1.9ef43ef29af92p-1,
-    0x1.a0c95eabaf934p-1,
-    0x1.a29a7a0462782p-1,
-    0x1.a4678c8119ac8p-1,
-    0x1.a63091b02fae0p-1,
-    0x1.a7f58529fe699p-1,
-    0x1.a9b66290ea1a3p-1,
-    0x1.ab7325916c0d3p-1,
-    0x1.ad2bc9e21d50ep-1,
-    0x1.aee04b43c1475p-1,
-    0x1.b090a581501ffp-1,
-    0x1.b23cd470013b3p-1,
-    0x1.b3e4d3ef5570fp-1,
-    0x1.b5889fe921405p-1,
-    0x1.b728345196e3dp-1,
-    0x1.b8c38d27504e7p-1,
-    0x1.ba5aa673590cfp-1,
-    0x1.bbed7c49380eap-1,
-    0x1.bd7c0ac6f9529p-1,
-    0x1.bf064e15377dbp-1,
-    0x1.c08c42672554ap-1,
-    0x1.c20de3fa971afp-1,
-    0x1.c38b2f180bdafp-1,
-    0x1.c5042012b6904p-1,
-    0x1.c678b3488739bp-1,
-    0x1.c7e8e52233cf2p-1,
-    0x1.c954b213411f3p-1,
-    0x1.cabc169a0b8fep-1,
-    0x1.cc1f0f3fcfc5cp-1,
-    0x1.cd7d9898b32f5p-1,
-    0x1.ced7af43cc771p-1,
-    0x1.d02d4feb2bd93p-1,
-    0x1.d17e7743e35dcp-1,
-    0x1.d2cb220e0ef9dp-1,
-    0x1.d4134d14dc938p-1,
-    0x1.d556f52e93eb1p-1,
-    0x1.d696173c9e68ap-1,
-    0x1.d7d0b02b8ecf8p-1,
-    0x1.d906bcf328d44p-1,
-    0x1.da383a9668988p-1,
-    0x1.db6526238a09ap-1,
-    0x1.dc8d7cb41025ep-1,
-    0x1.ddb13b6ccc23dp-1,
-    0x1.ded05f7de47d9p-1,
-    0x1.dfeae622dbe2ap-1,
-    0x1.e100cca2980aap-1,
-    0x1.e212104f686e5p-1,
-    0x1.e31eae870ce24p-1,
-    0x1.e426a4b2bc17dp-1,
-    0x1.e529f04729ffdp-1,
-    0x1.e6288ec48e112p-1,
-    0x1.e7227db6a9743p-1,
-    0x1.e817bab4cd10bp-1,
-    0x1.e9084361df7f3p-1,
-    0x1.e9f4156c62ddap-1,
-    0x1.eadb2e8e7a88dp-1,
-    0x1.ebbd8c8df0b73p-1,
-    0x1.ec9b2d3c3bf84p-1,
-    0x1.ed740e7684963p-1,
-    0x1.ee482e25a9dbbp-1,
-    0x1.ef178a3e473c3p-1,
-    0x1.efe220c0b95ecp-1,
-    0x1.f0a7efb9230d7p-1,
-    0x1.f168f53f7205cp-1,
-    0x1.f2252f7763adap-1,
-    0x1.f2dc9c9089a9dp-1,
-    0x1.f38f3ac64e588p-1,
-    0x1.f43d085ff92dbp-1,
-    0x1.f4e603b0b2f2dp-1,
-    0x1.f58a2b1789e84p-1,
-    0x1.f6297cff75cafp-1,
-    0x1.f6c3f7df5bbb8p-1,
-    0x1.f7599a3a12077p-1,
-    0x1.f7ea629e63d6ep-1,
-    0x1.f8764fa714ba8p-1,
-    0x1.f8fd5ffae41dbp-1,
-    0x1.f97f924c9099ap-1,
-    0x1.f9fce55adb2c8p-1,
-    0x1.fa7557f08a516p-1,
-    0x1.fae8e8e46cfbbp-1,
-    0x1.fb5797195d741p-1,
-    0x1.fbc1617e44185p-1,
-    0x1.fc26470e19fd3p-1,
-    0x1.fc8646cfeb721p-1,
-    0x1.fce15fd6da67bp-1,
-    0x1.fd37914220b84p-1,
-    0x1.fd88da3d12526p-1,
-    0x1.fdd539ff1f456p-1,
-    0x1.fe1cafcbd5b09p-1,
-    0x1.fe5f3af2e3940p-1,
-    0x1.fe9cdad01883ap-1,
-    0x1.fed58ecb673c4p-1,
-    0x1.ff095658e71adp-1,
-    0x1.ff3830f8d575cp-1,
-    0x1.ff621e3796d7ep-1,
-    0x1.ff871dadb81dfp-1,
-    0x1.ffa72effef75cp-1,
-    0x1.ffc251df1d3f8p-1,
-    0x1.ffd886084cd0dp-1,
-    0x1.ffe9cb44b51a1p-1,
-    0x1.fff62169b92dbp-1,
-    0x1.fffd8858e8a92p-1,
-    0x1.0000000000000p+0
-};
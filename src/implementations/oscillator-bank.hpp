@@ -4,11 +4,98 @@
 #include <vector>
 #include <sstream>
 #include <stdexcept>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <limits>
+#include <cmath>
 
 #include "common.hpp"
+#include "arena.hpp"
+#include "worker-pool.hpp"
+#include "work-stealing.hpp"
+#include "command-queue.hpp"
 
 
-namespace goldenrockefeller{ namespace fast_additive_comparison{
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Type-erased oscillator, so that one OscillatorBank can mix oscillator implementations.
+
+    Each wrapped oscillator carries a relative render cost (e.g. per-sample cost compared to
+    ApproxCos10Calculator) that the parallel bank uses to balance its render tasks. A silent
+    oscillator (zero amplitude) is not rendered at all and costs nothing.
+    */
+    template <typename sample_type>
+    class PolymorphicOscillator {
+        struct Concept {
+            virtual ~Concept() {}
+            virtual void reset(sample_type freq, sample_type ampl, sample_type phase) = 0;
+            virtual void progress_and_add(sample_type* signal_begin_ptr, sample_type* signal_end_ptr) = 0;
+        };
+
+        template <typename OscillatorT>
+        struct Model : Concept {
+            OscillatorT osc;
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) override {
+                this->osc.reset(freq, ampl, phase);
+            }
+
+            void progress_and_add(sample_type* signal_begin_ptr, sample_type* signal_end_ptr) override {
+                this->osc.progress_and_add(signal_begin_ptr, signal_end_ptr);
+            }
+        };
+
+        std::unique_ptr<Concept> impl;
+        double cost;
+        bool silent;
+
+        public:
+            typedef sample_type sample_type;
+
+            PolymorphicOscillator() : impl(), cost(0.), silent(true) {}
+
+            template <typename OscillatorT>
+            void assign(double cost) {
+                this->impl.reset(new Model<OscillatorT>());
+                this->cost = cost;
+                this->silent = true;
+            }
+
+            double render_cost() const {
+                return (this->impl && !this->silent) ? this->cost : 0.;
+            }
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                if (this->impl) {
+                    this->impl->reset(freq, ampl, phase);
+                }
+                this->silent = (ampl == sample_type(0.));
+            }
+
+            template<typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                if (!this->impl || this->silent || signal_end_it <= signal_begin_it) {
+                    return;
+                }
+
+                sample_type* signal_begin_ptr = &(*signal_begin_it);
+                this->impl->progress_and_add(signal_begin_ptr, signal_begin_ptr + (signal_end_it - signal_begin_it));
+            }
+        // public
+    };
+
+    template <typename OscillatorT>
+    inline double render_cost(const OscillatorT&) {
+        return 1.;
+    }
+
+    template <typename sample_type>
+    inline double render_cost(const PolymorphicOscillator<sample_type>& osc) {
+        return osc.render_cost();
+    }
+
     template<typename OscillatorT>
     class OscillatorBank {
         public:
@@ -18,16 +105,328 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
             using size_t = std::size_t;
             using vector_type = typename std::vector<OscillatorT>;
 
+            static constexpr size_t N_TASKS_PER_WORKER = 8;
+
+            // Arena mode. Oscillators whose blocks use an ArenaAllocator get all of their block
+            // storage from one slab owned by the bank, laid out in oscillator order. The arena
+            // is declared before the oscillators so that it outlives them.
+            std::unique_ptr<OscillatorArena> arena;
             vector_type oscs;
 
+            static std::unique_ptr<OscillatorArena> new_arena(size_t n_oscs) {
+                if (oscillator_arena_size<OscillatorT>::value == 0) {
+                    return std::unique_ptr<OscillatorArena>();
+                }
+                return std::unique_ptr<OscillatorArena>(new OscillatorArena(n_oscs * oscillator_arena_size<OscillatorT>::value));
+            }
+
+            static vector_type new_oscs(size_t n_oscs, OscillatorArena*, std::false_type) {
+                return vector_type(n_oscs);
+            }
+
+            static vector_type new_oscs(size_t n_oscs, OscillatorArena* arena, std::true_type) {
+                typename OscillatorT::block_allocator_type block_allocator(arena);
+                vector_type oscs;
+
+                oscs.reserve(n_oscs);
+                for (size_t osc_id = 0; osc_id < n_oscs; osc_id++) {
+                    oscs.emplace_back(sample_type(0), sample_type(0), sample_type(0), block_allocator);
+                }
+                return oscs;
+            }
+
+            static vector_type new_oscs(size_t n_oscs, OscillatorArena* arena) {
+                return OscillatorBank::new_oscs(n_oscs, arena, std::integral_constant<bool, (oscillator_arena_size<OscillatorT>::value > 0)>());
+            }
+
+            // Active list. Only the oscillators in the active list are rendered, so the render
+            // cost scales with the number of audible oscillators. An oscillator leaves the list
+            // when it is reset to zero amplitude (swapping the last active oscillator into its
+            // place), and joins it when it is reset to a non-zero amplitude or accessed through
+            // osc(). Both vectors are sized on construction, so updates never allocate.
+            static constexpr size_t INACTIVE = size_t(-1);
+
+            std::vector<size_t> active_osc_ids;
+            std::vector<size_t> active_list_positions; // INACTIVE for the oscillators not in the list
+
+            void set_active(size_t osc_id, bool is_active) {
+                auto position = this->active_list_positions[osc_id];
+
+                if (is_active && position == INACTIVE) {
+                    this->active_list_positions[osc_id] = this->active_osc_ids.size();
+                    this->active_osc_ids.push_back(osc_id);
+                }
+                else if (!is_active && position != INACTIVE) {
+                    auto last_osc_id = this->active_osc_ids.back();
+                    this->active_osc_ids[position] = last_osc_id;
+                    this->active_list_positions[last_osc_id] = position;
+                    this->active_osc_ids.pop_back();
+                    this->active_list_positions[osc_id] = INACTIVE;
+                }
+            }
+
+            // Culling policy. An oscillator that is reset to a frequency at or above max_freq (in
+            // absolute value), or to an amplitude below min_ampl (in absolute value), is culled:
+            // it stays out of the active list. The policy is off by default.
+            sample_type max_freq;
+            sample_type min_ampl;
+            std::vector<unsigned char> culled_flags;
+            size_t n_culled;
+
+            void set_culled(size_t osc_id, bool is_culled) {
+                if (bool(this->culled_flags[osc_id]) != is_culled) {
+                    this->culled_flags[osc_id] = is_culled;
+                    this->n_culled = is_culled ? this->n_culled + 1 : this->n_culled - 1;
+                }
+            }
+
+            // Command queue. Resets posted from a control thread are applied by the render thread
+            // at the start of the next progress_and_add.
+            std::unique_ptr<SpscQueue<ResetOscCommand<sample_type>>> command_queue;
+
+            void apply_commands() {
+                ResetOscCommand<sample_type> command;
+                while (this->command_queue->try_pop(command)) {
+                    this->_reset_osc(command.osc_id, command.freq, command.ampl, command.phase);
+                }
+            }
+
+            // Parallel render mode. The active oscillators are grouped into contiguous (in the active
+            // list), cost-weighted tasks that the workers take (and steal) from a work-stealing scheduler. Worker 0
+            // is the calling thread and adds straight into the signal; every other worker
+            // renders into its own scratch block, which the calling thread then reduces into
+            // the signal.
+            std::unique_ptr<WorkerPool> pool;
+            std::unique_ptr<WorkStealingScheduler> scheduler;
+            std::vector<std::vector<sample_type>> scratch_blocks;
+            std::vector<size_t> task_begin_positions; // in the active list
+            std::vector<double> task_costs;
+            bool tasks_are_stale;
+
+            void update_tasks() {
+                double total_cost = 0.;
+                for (size_t osc_id: this->active_osc_ids) {
+                    total_cost += render_cost(this->oscs[osc_id]);
+                }
+
+                double target_task_cost = total_cost / double(this->pool->n_workers() * N_TASKS_PER_WORKER);
+                size_t n_active_oscs = this->active_osc_ids.size();
+
+                this->task_begin_positions.clear();
+                this->task_costs.clear();
+
+                double task_cost = 0.;
+                this->task_begin_positions.push_back(0);
+                for (size_t position = 0; position < n_active_oscs; position++) {
+                    task_cost += render_cost(this->oscs[this->active_osc_ids[position]]);
+                    if (task_cost > 0. && task_cost >= target_task_cost && position + 1 < n_active_oscs) {
+                        this->task_begin_positions.push_back(position + 1);
+                        this->task_costs.push_back(task_cost);
+                        task_cost = 0.;
+                    }
+                }
+                this->task_begin_positions.push_back(n_active_oscs);
+                this->task_costs.push_back(task_cost);
+
+                this->tasks_are_stale = false;
+            }
+
+            template <typename iterator_type>
+            struct ParallelRenderJob {
+                OscillatorBank* bank;
+                iterator_type signal_begin_it;
+                iterator_type signal_end_it;
+
+                template <typename signal_iterator_type>
+                void render_task(size_t task_id, signal_iterator_type task_signal_begin_it, signal_iterator_type task_signal_end_it) {
+                    auto osc_ids_begin_it = bank->active_osc_ids.begin() + bank->task_begin_positions[task_id];
+                    auto osc_ids_end_it = bank->active_osc_ids.begin() + bank->task_begin_positions[task_id + 1];
+
+                    for (auto osc_id_it = osc_ids_begin_it; osc_id_it < osc_ids_end_it; ++osc_id_it) {
+                        bank->oscs[*osc_id_it].progress_and_add(task_signal_begin_it, task_signal_end_it);
+                    }
+                }
+
+                void operator()(size_t worker_id) {
+                    size_t task_id;
+
+                    if (worker_id == 0) {
+                        while (bank->scheduler->next_task(worker_id, task_id)) {
+                            this->render_task(task_id, signal_begin_it, signal_end_it);
+                        }
+                        return;
+                    }
+
+                    auto& scratch_block = bank->scratch_blocks[worker_id - 1];
+                    auto scratch_end_it = scratch_block.begin() + (signal_end_it - signal_begin_it);
+                    std::fill(scratch_block.begin(), scratch_end_it, sample_type(0.));
+
+                    while (bank->scheduler->next_task(worker_id, task_id)) {
+                        this->render_task(task_id, scratch_block.begin(), scratch_end_it);
+                    }
+                }
+            };
+
+            template <typename iterator_type>
+            void progress_and_add_parallel(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                if (this->tasks_are_stale) {
+                    this->update_tasks();
+                }
+                this->scheduler->assign(this->task_costs);
+
+                ParallelRenderJob<iterator_type> job{this, signal_begin_it, signal_end_it};
+                this->pool->run(job);
+
+                size_t chunk_size = size_t(signal_end_it - signal_begin_it);
+                for (const auto& scratch_block : this->scratch_blocks) {
+                    auto signal_it = signal_begin_it;
+                    for (size_t i = 0; i < chunk_size; i++) {
+                        *signal_it += scratch_block[i];
+                        ++signal_it;
+                    }
+                }
+            }
+
         public:
             typedef sample_type sample_type;
 
             OscillatorBank() : OscillatorBank(0) {}
-            OscillatorBank(size_t n_oscs) : oscs(n_oscs) {}
+            OscillatorBank(size_t n_oscs) : 
+                arena(OscillatorBank::new_arena(n_oscs)), 
+                oscs(OscillatorBank::new_oscs(n_oscs, arena.get())), 
+                active_list_positions(n_oscs, INACTIVE),
+                max_freq(std::numeric_limits<sample_type>::infinity()),
+                min_ampl(sample_type(0.)),
+                culled_flags(n_oscs, 0),
+                n_culled(0),
+                tasks_are_stale(true) 
+            {
+                this->active_osc_ids.reserve(n_oscs);
+            }
+
+            /*
+            A bank with n_threads > 1 renders in parallel on a persistent worker pool. Chunks
+            longer than scratch_size are rendered scratch_size samples at a time.
+            */
+            OscillatorBank(size_t n_oscs, size_t n_threads, size_t scratch_size = 1024) : 
+                arena(OscillatorBank::new_arena(n_oscs)), 
+                oscs(OscillatorBank::new_oscs(n_oscs, arena.get())),
+                active_list_positions(n_oscs, INACTIVE),
+                max_freq(std::numeric_limits<sample_type>::infinity()),
+                min_ampl(sample_type(0.)),
+                culled_flags(n_oscs, 0),
+                n_culled(0),
+                tasks_are_stale(true)
+            {
+                this->active_osc_ids.reserve(n_oscs);
+
+                if (n_threads > 1) {
+                    if (scratch_size == 0) {
+                        std::ostringstream msg;
+                        msg << "The scratch size "
+                            << "(scratch_size = " << scratch_size << ") "
+                            << "must be positive";
+                        throw std::invalid_argument(msg.str());
+                    }
+
+                    this->pool.reset(new WorkerPool(n_threads));
+                    this->scheduler.reset(new WorkStealingScheduler(n_threads));
+                    this->scratch_blocks.assign(n_threads - 1, std::vector<sample_type>(scratch_size, sample_type(0.)));
+                    this->task_begin_positions.reserve(n_oscs + 2);
+                    this->task_costs.reserve(n_oscs + 1);
+                }
+            }
+
+            size_t n_active_oscs() const {
+                return this->active_osc_ids.size();
+            }
+
+            /*
+            Cull the oscillators that are reset to a frequency at or above max_freq (e.g. 0.5
+            cycles/sample, to drop the partials that would alias), or to an amplitude below
+            min_ampl. The policy applies from the next reset_osc on. Culled oscillators are not
+            rendered, and are counted by n_culled_oscs().
+            */
+            void set_culling(sample_type max_freq, sample_type min_ampl) {
+                if (!(max_freq > sample_type(0.)) || !(min_ampl >= sample_type(0.))) {
+                    std::ostringstream msg;
+                    msg << "The culling frequency "
+                        << "(max_freq = " << max_freq << ") "
+                        << "must be positive and the culling amplitude "
+                        << "(min_ampl = " << min_ampl << ") "
+                        << "must be non-negative";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                this->max_freq = max_freq;
+                this->min_ampl = min_ampl;
+            }
+
+            void disable_culling() {
+                this->max_freq = std::numeric_limits<sample_type>::infinity();
+                this->min_ampl = sample_type(0.);
+            }
+
+            size_t n_culled_oscs() const {
+                return this->n_culled;
+            }
+
+            /*
+            Let one control thread post resets with post_reset_osc while the render thread is in
+            progress_and_add. Call this before rendering starts.
+            */
+            void enable_command_queue(size_t capacity) {
+                this->command_queue.reset(new SpscQueue<ResetOscCommand<sample_type>>(capacity));
+            }
+
+            /*
+            Queue a reset for the next progress_and_add. Only one thread may post. Never waits;
+            returns false (and drops the reset) if the queue is full.
+            */
+            bool post_reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                if (!this->command_queue) {
+                    throw std::logic_error("The command queue must be enabled (with enable_command_queue) before posting resets");
+                }
+
+                if (osc_id >=  oscs.size()) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(oscs.size() = " << oscs.size() << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                ResetOscCommand<sample_type> command = {osc_id, freq, ampl, phase};
+                return this->command_queue->try_push(command);
+            }
+
+            OscillatorT& osc(size_t osc_id) {
+                if (osc_id >=  oscs.size()) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(oscs.size() = " << oscs.size() << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                // The caller may make the oscillator audible, so it is rendered until it is reset
+                // to zero amplitude.
+                this->set_culled(osc_id, false);
+                this->set_active(osc_id, true);
+                this->tasks_are_stale = true;
+                return this->oscs[osc_id];
+            }
 
             void _reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                bool is_audible = (ampl != sample_type(0.));
+                bool is_culled = is_audible && (std::abs(freq) >= this->max_freq || std::abs(ampl) < this->min_ampl);
+
                 this->oscs[osc_id].reset(freq, ampl, phase);
+                this->set_culled(osc_id, is_culled);
+                this->set_active(osc_id, is_audible && !is_culled);
+                this->tasks_are_stale = true;
             }
 
             void reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
@@ -43,14 +442,79 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
                 this->_reset_osc(osc_id, freq, ampl, phase);
             }
 
+            /*
+            Reset oscillators 0 to n_oscs - 1 from contiguous arrays, with a single bounds check.
+
+            This costs the same as n_oscs calls to reset_osc, less their bounds checks: each
+            oscillator is still reset on its own (SineOscillator::reset already fills its phase
+            block in one vectorized pass). SoaOscillatorBank::reset_oscs is the bulk reset that
+            vectorizes across oscillators.
+            */
+            void reset_oscs(const sample_type* freqs, const sample_type* ampls, const sample_type* phases, size_t n_oscs) {
+                if (n_oscs > this->oscs.size()) {
+                    std::ostringstream msg;
+                    msg << "The number of oscilators to reset "
+                        << "(n_oscs = " << n_oscs << ") "
+                        << "must not be greater than the number of oscilators "
+                        << "(oscs.size() = " << this->oscs.size() << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t i = 0; i < n_oscs; i++) {
+                    this->_reset_osc(i, freqs[i], ampls[i], phases[i]);
+                }
+            }
+
+            /*
+            Reset the oscillators osc_ids[0] to osc_ids[n_oscs - 1] from contiguous arrays. Every
+            id is checked before any oscillator is reset. As
+            above, only the per-call bounds checks are saved.
+            */
+            void reset_oscs(const size_t* osc_ids, const sample_type* freqs, const sample_type* ampls, const sample_type* phases, size_t n_oscs) {
+                size_t max_osc_id = 0;
+                for (size_t i = 0; i < n_oscs; i++) {
+                    max_osc_id = std::max(max_osc_id, osc_ids[i]);
+                }
+
+                if (n_oscs > 0 && max_osc_id >= this->oscs.size()) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << max_osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(oscs.size() = " << this->oscs.size() << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t i = 0; i < n_oscs; i++) {
+                    this->_reset_osc(osc_ids[i], freqs[i], ampls[i], phases[i]);
+                }
+            }
+
             template <typename iterator_type>
             void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
-                for (OscillatorT& osc: oscs) {
-                    osc.progress_and_add(signal_begin_it, signal_end_it);
+                if (this->command_queue) {
+                    this->apply_commands();
+                }
+
+                if (!this->pool) {
+                    for (size_t osc_id: this->active_osc_ids) {
+                        this->oscs[osc_id].progress_and_add(signal_begin_it, signal_end_it);
+                    }
+                    return;
+                }
+
+                size_t scratch_size = this->scratch_blocks.front().size();
+                for (auto chunk_begin_it = signal_begin_it; chunk_begin_it < signal_end_it; ) {
+                    auto chunk_end_it = chunk_begin_it + std::min(size_t(signal_end_it - chunk_begin_it), scratch_size);
+                    this->progress_and_add_parallel(chunk_begin_it, chunk_end_it);
+                    chunk_begin_it = chunk_end_it;
                 }
             }
         // public
     };
-}}
+
+    template<typename OscillatorT>
+    constexpr std::size_t OscillatorBank<OscillatorT>::INACTIVE;
+}}}
 
 #endif
\ No newline at end of file
@@ -7,11 +7,14 @@
 #include <sstream>
 #include <stdexcept>
 #include <array>
+#include <type_traits>
 
 #include "common.hpp"
+#include "arena.hpp"
+#include "lookup-table.hpp"
 
 
-namespace goldenrockefeller{ namespace fast_additive_comparison{
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
     template <typename sample_type>
     class SimpleExactSineOscillator {
         using size_t = std::size_t;
@@ -88,6 +91,33 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
         }
     };
     
+    /* Even polynomial approximation of cos on [-pi, pi], for a given degree and evaluation scheme. */
+    template <std::size_t DEGREE, PolynomialScheme SCHEME = PolynomialScheme::fused_estrin>
+    struct PolynomialCosineCalculator {
+        template <typename operand_type>
+        static inline operand_type cos(const operand_type& x) {
+            return approx_cos<DEGREE, SCHEME>(x);
+        }
+    };
+
+    /* Quarter-wave folded polynomial approximation of cos on [-pi, pi] (see approx_cos_quarter_wave). */
+    template <std::size_t DEGREE, PolynomialScheme SCHEME = PolynomialScheme::fused_estrin>
+    struct QuarterWaveCosineCalculator {
+        template <typename operand_type>
+        static inline operand_type cos(const operand_type& x) {
+            return approx_cos_quarter_wave<DEGREE, SCHEME>(x);
+        }
+    };
+
+    /* PolynomialCosineCalculator that can also compute sin and cos jointly (see approx_sincos). */
+    template <std::size_t DEGREE, PolynomialScheme SCHEME = PolynomialScheme::fused_estrin>
+    struct PolynomialSinCosCalculator : PolynomialCosineCalculator<DEGREE, SCHEME> {
+        template <typename operand_type>
+        static inline void sincos(const operand_type& x, operand_type& sin_x, operand_type& cos_x) {
+            approx_sincos<DEGREE, SCHEME>(x, sin_x, cos_x);
+        }
+    };
+
     struct IdentityCalculator {
         template <typename operand_type>
         static inline operand_type cos(const operand_type& x) {
@@ -96,49 +126,102 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
     };
 
 
-    #include "lookup_table.h"
-    
-    template <typename sample_type>
-    sample_type lookup_cos (const sample_type& x) {
-        return lookup_table[ size_t( x)];
-    }
+    enum class LookupInterpolation {
+        none, // nearest table entry
+        linear,
+        cubic // 4-point Lagrange
+    };
 
-    template <typename sample_type>
+    /*
+    Cosine from a table of cos over [0, 2 pi]. Every lane is gathered from the table at once, and
+    the result is optionally interpolated between neighbouring table entries.
+
+    The table has N_TABLE_SEGMENTS segments of table_sample_type entries. A small float table
+    (e.g. 256 segments, about 1 KiB) puts less pressure on the L1 cache than the default one.
+    */
+    template <
+        typename sample_type, 
+        LookupInterpolation INTERPOLATION = LookupInterpolation::none, 
+        std::size_t N_TABLE_SEGMENTS = 1024, 
+        typename table_sample_type = sample_type
+    >
     struct LookupCalculator {
+        using table_type = CosineTable<table_sample_type, N_TABLE_SEGMENTS>;
+
         template <typename operand_type>
-        static inline operand_type cos(const operand_type& x) {
-            static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
-            static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
+        static inline operand_type table_position(const operand_type& x) {
+            // Position in [0, N_TABLE_SEGMENTS] of x in [-pi, pi].
+            constexpr double step_size = double(N_TABLE_SEGMENTS) / tau<double>();
+            return (x + operand_type(x < sample_type(0.)) * tau<sample_type>()) * operand_type(sample_type(step_size));
+        }
 
-            static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
+        template <typename operand_type>
+        static inline operand_type cos(const operand_type& x) {
+            return interpolate(table_position(x), std::integral_constant<LookupInterpolation, INTERPOLATION>());
+        }
 
-            
-            constexpr double step_size = 1024. / tau<sample_type>();
+        template <typename operand_type>
+        static inline operand_type interpolate(const operand_type& pos, std::integral_constant<LookupInterpolation, LookupInterpolation::none>) {
+            return gather_operand(table_type::values, floor_operand(pos + operand_type(sample_type(0.5))));
+        }
 
-            operand_type x_id;
+        template <typename operand_type>
+        static inline operand_type interpolate(const operand_type& pos, std::integral_constant<LookupInterpolation, LookupInterpolation::linear>) {
+            const operand_type last_id = operand_type(sample_type(N_TABLE_SEGMENTS - 1));
 
-            x_id = (x + operand_type(x < 0.) * tau<sample_type>()) * operand_type(step_size);
+            auto id = floor_operand(pos);
+            id = id - operand_type(id > last_id);
+            auto frac = pos - id;
 
-            operand_type y;
-            const sample_type* x_id_ptr = reinterpret_cast<const sample_type*>(&x_id);
-            sample_type* y_ptr = reinterpret_cast<sample_type*>(&y);
+            auto y0 = gather_operand(table_type::values, id);
+            auto y1 = gather_operand(table_type::values, id + operand_type(sample_type(1.)));
+            return y0 + frac * (y1 - y0);
+        }
 
-            for (size_t i = 0; i < N_SAMPLES_PER_OPERAND; i++) {
-                y_ptr[i] = lookup_cos(sample_type(x_id_ptr[i]));
-            }
-            return y;
+        template <typename operand_type>
+        static inline operand_type interpolate(const operand_type& pos, std::integral_constant<LookupInterpolation, LookupInterpolation::cubic>) {
+            const operand_type one = operand_type(sample_type(1.));
+            const operand_type two = operand_type(sample_type(2.));
+            const operand_type n_segments = operand_type(sample_type(N_TABLE_SEGMENTS));
+            const operand_type last_id = operand_type(sample_type(N_TABLE_SEGMENTS - 1));
+
+            auto id = floor_operand(pos);
+            id = id - operand_type(id > last_id);
+            auto frac = pos - id;
+
+            // The table is periodic; the first and last entries are both cos(0).
+            auto prev_id = id - one + operand_type(id < one) * n_segments;
+            auto next_next_id = id + two - operand_type(id + two > n_segments) * n_segments;
+
+            auto y_prev = gather_operand(table_type::values, prev_id);
+            auto y0 = gather_operand(table_type::values, id);
+            auto y1 = gather_operand(table_type::values, id + one);
+            auto y_next_next = gather_operand(table_type::values, next_next_id);
+
+            auto frac_plus_one = frac + one;
+            auto frac_minus_one = frac - one;
+            auto frac_minus_two = frac - two;
+            const operand_type one_half = operand_type(sample_type(0.5));
+            const operand_type one_sixth = operand_type(sample_type(1. / 6.));
+
+            return (
+                y0 * (frac_plus_one * frac_minus_one * frac_minus_two * one_half)
+                - y1 * (frac_plus_one * frac * frac_minus_two * one_half)
+                + (y_next_next * frac_plus_one - y_prev * frac_minus_two) * (frac * frac_minus_one * one_sixth)
+            );
         }
     };
 
-    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename CosineCalculatorT> 
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename CosineCalculatorT, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>> 
     class SineOscillator{
         static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
         static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
         static_assert(N_OPERANDS_PER_BLOCK >= 1, "The operand block length must be positive");
 
         using size_t = std::size_t;
-        using vector_type = typename std::vector<sample_type>;
-        using vector_iterator_type = typename std::vector<sample_type>::iterator;
+        using vector_type = typename std::vector<sample_type, BlockAllocatorT>;
+        using vector_iterator_type = typename vector_type::iterator;
+        using block_access = typename allocator_operand_access<operand_type, BlockAllocatorT>::type;
 
         static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
         static constexpr size_t N_SAMPLES_PER_BLOCK = N_OPERANDS_PER_BLOCK * sizeof(operand_type) / sizeof(sample_type);
@@ -154,25 +237,28 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
         vector_iterator_type osc_block_safe_end_it;
         vector_iterator_type osc_block_safe_begin_it;
 
+        PhaseAmplitudeRamp<sample_type, operand_type> param_ramp;
+
         static inline void progress_phase_operand(sample_type& phase_ref, const operand_type& delta_phase_per_block) {
             operand_type phase_operand;
-            load(&phase_ref, phase_operand);
+            block_access::load(&phase_ref, phase_operand);
             phase_operand += delta_phase_per_block;
             phase_operand = wrap_phase_bounded(phase_operand);
-            store(&phase_ref, phase_operand);
+            block_access::store(&phase_ref, phase_operand);
         }
 
         static inline void update_osc_operand(sample_type& osc_ref, const sample_type& phase_ref, const operand_type& ampl_operand) {
             operand_type osc_operand;
             operand_type phase_operand;
-            load(&phase_ref, phase_operand); 
+            block_access::load(&phase_ref, phase_operand); 
             osc_operand  = ampl_operand * CosineCalculatorT::cos(phase_operand);
-            store(&osc_ref, osc_operand);
+            block_access::store(&osc_ref, osc_operand);
         }
 
     
         public:
             typedef sample_type sample_type;
+            typedef BlockAllocatorT block_allocator_type;
 
             static void init_phase_block(vector_type& phase_block, sample_type freq, sample_type phase) {
                 if (phase_block.size() !=  N_SAMPLES_PER_BLOCK) {
@@ -184,70 +270,38 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
                     throw std::invalid_argument(msg.str());
                 }
 
-                auto delta_phase_per_sample = wrap_phase_offset(tau<sample_type>() * freq);
-                phase = wrap_phase(phase);
-
-                // Fill the first phase operand
-                for (auto it = phase_block.begin(); it < phase_block.begin() + N_SAMPLES_PER_OPERAND; ++it){
-                    *it = phase;
-                    phase += delta_phase_per_sample;
-                    phase = wrap_phase_bounded(phase);
-                }
-
-                operand_type delta_phase_per_operand(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_OPERAND));
-
-                // Fill the first phase block
-                operand_type prev_phase_operand;
-                load(phase_block.data(), prev_phase_operand);
-                for (size_t i = N_SAMPLES_PER_OPERAND; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
-                    operand_type phase_operand;
-                    load(&phase_block[i], phase_operand);
-                    phase_operand = wrap_phase_bounded(prev_phase_operand + delta_phase_per_operand);
-                    prev_phase_operand = phase_operand;
-                    store(&phase_block[i], phase_operand);
-                }  
-
-            }
-
-            static vector_type new_phase_block(sample_type freq, sample_type phase) {
-
-                vector_type phase_block(N_SAMPLES_PER_BLOCK, 0.);                
-                SineOscillator::init_phase_block(phase_block, freq, phase);
-                return phase_block;
-            }
-
-            static vector_type new_osc_block(sample_type freq, sample_type ampl, sample_type phase) {
-                auto phase_block = new_phase_block(freq, phase);
-                vector_type osc_block(phase_block.size() + N_SAMPLES_PER_OPERAND, 0.);      
-
-                operand_type ampl_operand(ampl);
+                // Every phase is computed directly from its sample id, so the operands do not
+                // depend on each other and the whole block is filled in one vectorized pass.
+                operand_type delta_phase_per_sample(wrap_phase_offset(tau<sample_type>() * freq));
+                operand_type phase_operand(wrap_phase(phase));
+                operand_type sample_id_operand = lane_index_operand<sample_type, operand_type>();
 
                 for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
-                    SineOscillator::update_osc_operand(
-                        osc_block[i + N_SAMPLES_PER_OPERAND], 
-                        phase_block[i],
-                        ampl_operand
+                    block_access::store(
+                        &phase_block[i], 
+                        wrap_phase(phase_operand + sample_id_operand * delta_phase_per_sample)
                     );
+                    sample_id_operand += operand_type(sample_type(N_SAMPLES_PER_OPERAND));
                 }
-
-                return osc_block;
             }
 
             SineOscillator() : SineOscillator(sample_type(0), sample_type(0), sample_type(0)) {}
 
-            SineOscillator(sample_type freq, sample_type ampl, sample_type phase) :
-                freq(freq),
-                ampl_operand(ampl),
-                delta_phase_per_block(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_BLOCK)),
-                phase_block(SineOscillator::new_phase_block(freq, phase)),
-                osc_block(SineOscillator::new_osc_block(freq, ampl, phase)),
-                osc_block_safe_end_it(osc_block.begin() + N_SAMPLES_PER_BLOCK),
-                osc_block_safe_begin_it(osc_block.begin() + N_SAMPLES_PER_OPERAND),
-                osc_block_it(osc_block.begin()+N_SAMPLES_PER_OPERAND)
+            SineOscillator(sample_type freq, sample_type ampl, sample_type phase) : 
+                SineOscillator(freq, ampl, phase, BlockAllocatorT()) 
             {}
 
+            SineOscillator(sample_type freq, sample_type ampl, sample_type phase, const BlockAllocatorT& block_allocator) :
+                freq(freq),
+                osc_block(N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND, sample_type(0.), block_allocator),
+                phase_block(N_SAMPLES_PER_BLOCK, sample_type(0.), block_allocator)
+            {
+                this->reset(freq, ampl, phase);
+            }
+
             void reset(sample_type freq, sample_type ampl, sample_type phase) {
                 this->freq = 0.*freq;
+                this->param_ramp.reset(freq, ampl, phase);
                 this->ampl_operand = operand_type(ampl);
                 this->delta_phase_per_block = operand_type(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_BLOCK));
                 SineOscillator::init_phase_block(this->phase_block, freq, phase);
@@ -273,18 +327,53 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
                 }
             }
 
+            void update_ramp_block() {
+                for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
+                    operand_type phase_operand;
+                    operand_type ramp_ampl_operand;
+                    this->param_ramp.get_operands(i, phase_operand, ramp_ampl_operand);
+                    block_access::store(&this->phase_block[i], phase_operand);
+                    block_access::store(&this->osc_block[i + N_SAMPLES_PER_OPERAND], ramp_ampl_operand * CosineCalculatorT::cos(phase_operand));
+                }
+
+                if (!this->param_ramp.is_ramping()) {
+                    // The block now has a constant phase increment, so the regular block update takes over.
+                    this->ampl_operand = operand_type(this->param_ramp.final_ampl());
+                    this->delta_phase_per_block = operand_type(wrap_phase_offset(tau<sample_type>() * this->param_ramp.final_freq() * N_SAMPLES_PER_BLOCK));
+                }
+            }
+
             void prorgess_osc_block(size_t sample_offset) {
                 operand_type last_osc_operand;
                 
-                load(&(*this->osc_block_safe_end_it), last_osc_operand);
-                store(this->osc_block.data(), last_osc_operand);
+                block_access::load(&(*this->osc_block_safe_end_it), last_osc_operand);
+                block_access::store(this->osc_block.data(), last_osc_operand);
 
-                this->progress_phase_block();
-                this->update_osc_block();
+                if (this->param_ramp.is_ramping()) {
+                    this->param_ramp.advance(N_SAMPLES_PER_BLOCK);
+                    this->update_ramp_block();
+                }
+                else {
+                    this->param_ramp.advance(N_SAMPLES_PER_BLOCK);
+                    this->progress_phase_block();
+                    this->update_osc_block();
+                }
 
                 this->osc_block_it = this->osc_block.begin() + sample_offset;
             }
 
+            /*
+            Glide to a new frequency and amplitude over the next n_samples samples, keeping the
+            phase continuous. The ramp starts at the next sample to be rendered; n_samples = 0
+            jumps to the new values without a phase reset.
+            */
+            void ramp(sample_type freq, sample_type ampl, size_t n_samples) {
+                auto sample_id = std::ptrdiff_t(this->osc_block_it - this->osc_block.begin()) - std::ptrdiff_t(N_SAMPLES_PER_OPERAND);
+                this->param_ramp.start(sample_id, freq, ampl, n_samples);
+                this->update_ramp_block();
+                this->osc_block_it = this->osc_block.begin() + N_SAMPLES_PER_OPERAND;
+            }
+
             template<typename iterator_type>
             void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it)    {
                 
@@ -345,7 +434,279 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
             }
         // public
     };
-}}
+
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename CosineCalculatorT, std::size_t ALIGNMENT>
+    struct oscillator_arena_size<SineOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, CosineCalculatorT, ArenaAllocator<sample_type, ALIGNMENT>>> {
+        // osc_block and phase_block
+        static constexpr std::size_t value = 
+            arena_allocation_size<sample_type, ALIGNMENT>((N_OPERANDS_PER_BLOCK + 1) * sizeof(operand_type) / sizeof(sample_type))
+            + arena_allocation_size<sample_type, ALIGNMENT>(N_OPERANDS_PER_BLOCK * sizeof(operand_type) / sizeof(sample_type));
+    };
+
+    /*
+    Phase-to-amplitude oscillator with an in-phase (ampl * cos(phase)) and a quadrature
+    (ampl * sin(phase)) output, for analytic partials. Both outputs come from one joint sin/cos
+    evaluation per phase operand, so SinCosCalculatorT must provide sincos (e.g.
+    PolynomialSinCosCalculator).
+    */
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename SinCosCalculatorT, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>> 
+    class QuadratureSineOscillator{
+        static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
+        static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
+        static_assert(N_OPERANDS_PER_BLOCK >= 1, "The operand block length must be positive");
+
+        using size_t = std::size_t;
+        using vector_type = typename std::vector<sample_type, BlockAllocatorT>;
+        using vector_iterator_type = typename vector_type::iterator;
+        using block_access = typename allocator_operand_access<operand_type, BlockAllocatorT>::type;
+        using phase_oscillator_type = SineOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, SinCosCalculatorT, BlockAllocatorT>;
+
+        static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
+        static constexpr size_t N_SAMPLES_PER_BLOCK = N_OPERANDS_PER_BLOCK * sizeof(operand_type) / sizeof(sample_type);
+
+        operand_type ampl_operand;
+        operand_type delta_phase_per_block;
+
+        vector_type osc_block;
+        vector_type quad_osc_block;
+        vector_type phase_block;
+        size_t osc_block_pos;
+
+        void update_osc_blocks() {
+            for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
+                operand_type phase_operand;
+                operand_type sin_operand;
+                operand_type cos_operand;
+                block_access::load(&this->phase_block[i], phase_operand);
+                SinCosCalculatorT::sincos(phase_operand, sin_operand, cos_operand);
+                block_access::store(&this->osc_block[i + N_SAMPLES_PER_OPERAND], this->ampl_operand * cos_operand);
+                block_access::store(&this->quad_osc_block[i + N_SAMPLES_PER_OPERAND], this->ampl_operand * sin_operand);
+            }
+        }
+
+        void progress_osc_blocks() {
+            operand_type last_osc_operand;
+            block_access::load(&this->osc_block[N_SAMPLES_PER_BLOCK], last_osc_operand);
+            block_access::store(this->osc_block.data(), last_osc_operand);
+            block_access::load(&this->quad_osc_block[N_SAMPLES_PER_BLOCK], last_osc_operand);
+            block_access::store(this->quad_osc_block.data(), last_osc_operand);
+
+            for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
+                operand_type phase_operand;
+                block_access::load(&this->phase_block[i], phase_operand);
+                phase_operand = wrap_phase_bounded(phase_operand + this->delta_phase_per_block);
+                block_access::store(&this->phase_block[i], phase_operand);
+            }
+
+            this->update_osc_blocks();
+            this->osc_block_pos -= N_SAMPLES_PER_BLOCK;
+        }
+
+        template<bool HAS_QUADRATURE, typename iterator_type, typename quad_iterator_type>
+        void render(iterator_type signal_begin_it, iterator_type signal_end_it, quad_iterator_type quad_signal_begin_it) {
+            if (signal_end_it < signal_begin_it) {
+                return;
+            }
+
+            size_t n_samples = size_t(signal_end_it - signal_begin_it);
+
+            if (n_samples < N_SAMPLES_PER_OPERAND) { // it is not safe to vectorize
+                for (size_t i = 0; i < n_samples; i++) {
+                    if (this->osc_block_pos > N_SAMPLES_PER_BLOCK) {
+                        this->progress_osc_blocks();
+                    }
+
+                    signal_begin_it[i] += this->osc_block[this->osc_block_pos];
+                    if (HAS_QUADRATURE) {
+                        quad_signal_begin_it[i] += this->quad_osc_block[this->osc_block_pos];
+                    }
+                    this->osc_block_pos++;
+                }
+                return;
+            }
+
+            // The last operand may overlap the one before it, so it is loaded before anything is
+            // added, and stored last.
+            size_t safe_end_i = n_samples - N_SAMPLES_PER_OPERAND;
+            operand_type last_signal_operand;
+            operand_type last_quad_signal_operand;
+            load(&signal_begin_it[safe_end_i], last_signal_operand);
+            if (HAS_QUADRATURE) {
+                load(&quad_signal_begin_it[safe_end_i], last_quad_signal_operand);
+            }
+
+            size_t i = 0;
+            for (; i < safe_end_i; i += N_SAMPLES_PER_OPERAND) {
+                if (this->osc_block_pos > N_SAMPLES_PER_BLOCK) {
+                    this->progress_osc_blocks();
+                }
+
+                operand_type signal_operand;
+                operand_type osc_operand;
+                load(&signal_begin_it[i], signal_operand);
+                load(&this->osc_block[this->osc_block_pos], osc_operand);
+                store(&signal_begin_it[i], signal_operand + osc_operand);
+
+                if (HAS_QUADRATURE) {
+                    load(&quad_signal_begin_it[i], signal_operand);
+                    load(&this->quad_osc_block[this->osc_block_pos], osc_operand);
+                    store(&quad_signal_begin_it[i], signal_operand + osc_operand);
+                }
+
+                this->osc_block_pos += N_SAMPLES_PER_OPERAND;
+            }
+
+            this->osc_block_pos -= i - safe_end_i;
+
+            if (this->osc_block_pos > N_SAMPLES_PER_BLOCK) {
+                this->progress_osc_blocks();
+            }
+
+            operand_type osc_operand;
+            load(&this->osc_block[this->osc_block_pos], osc_operand);
+            store(&signal_begin_it[safe_end_i], last_signal_operand + osc_operand);
+
+            if (HAS_QUADRATURE) {
+                load(&this->quad_osc_block[this->osc_block_pos], osc_operand);
+                store(&quad_signal_begin_it[safe_end_i], last_quad_signal_operand + osc_operand);
+            }
+
+            this->osc_block_pos += N_SAMPLES_PER_OPERAND;
+        }
+    
+        public:
+            typedef sample_type sample_type;
+            typedef BlockAllocatorT block_allocator_type;
+
+            QuadratureSineOscillator() : QuadratureSineOscillator(sample_type(0), sample_type(0), sample_type(0)) {}
+
+            QuadratureSineOscillator(sample_type freq, sample_type ampl, sample_type phase) : 
+                QuadratureSineOscillator(freq, ampl, phase, BlockAllocatorT()) 
+            {}
+
+            QuadratureSineOscillator(sample_type freq, sample_type ampl, sample_type phase, const BlockAllocatorT& block_allocator) :
+                osc_block(N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND, sample_type(0.), block_allocator),
+                quad_osc_block(N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND, sample_type(0.), block_allocator),
+                phase_block(N_SAMPLES_PER_BLOCK, sample_type(0.), block_allocator)
+            {
+                this->reset(freq, ampl, phase);
+            }
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                this->ampl_operand = operand_type(ampl);
+                this->delta_phase_per_block = operand_type(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_BLOCK));
+                phase_oscillator_type::init_phase_block(this->phase_block, freq, phase);
+                this->update_osc_blocks();
+                this->osc_block_pos = N_SAMPLES_PER_OPERAND;
+            }
+
+            /* Add the in-phase output only, like any other oscillator. */
+            template<typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                this->render<false>(signal_begin_it, signal_end_it, signal_begin_it);
+            }
+
+            /* 
+            Add the in-phase output to [signal_begin_it, signal_end_it), and the quadrature output to
+            the same number of samples from quad_signal_begin_it.
+            */
+            template<typename iterator_type, typename quad_iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it, quad_iterator_type quad_signal_begin_it) {
+                this->render<true>(signal_begin_it, signal_end_it, quad_signal_begin_it);
+            }
+        // public
+    };
+
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename SinCosCalculatorT, std::size_t ALIGNMENT>
+    struct oscillator_arena_size<QuadratureSineOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, SinCosCalculatorT, ArenaAllocator<sample_type, ALIGNMENT>>> {
+        // osc_block, quad_osc_block and phase_block
+        static constexpr std::size_t value = 
+            2 * arena_allocation_size<sample_type, ALIGNMENT>((N_OPERANDS_PER_BLOCK + 1) * sizeof(operand_type) / sizeof(sample_type))
+            + arena_allocation_size<sample_type, ALIGNMENT>(N_OPERANDS_PER_BLOCK * sizeof(operand_type) / sizeof(sample_type));
+    };
+
+    /*
+    Sine oscillator without blocks. It keeps only the phases of its next N_SAMPLES_PER_OPERAND
+    samples (a base phase plus per-lane offsets) in one operand, and advances them in registers,
+    one operand at a time, while rendering. Its whole state is a few operands, against the
+    2 * N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND samples of a SineOscillator, so very large
+    banks stay in cache. The price is that the phases advance every operand instead of every
+    block.
+    */
+    template <typename sample_type, typename operand_type, typename CosineCalculatorT> 
+    class CompactSineOscillator{
+        static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
+        static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
+
+        using size_t = std::size_t;
+
+        static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
+
+        operand_type phase_operand;
+        operand_type delta_phase_per_operand;
+        operand_type ampl_operand;
+        sample_type delta_phase_per_sample;
+
+        // Move the phases n_samples (< N_SAMPLES_PER_OPERAND) samples forward.
+        void skip_samples(size_t n_samples) {
+            this->phase_operand = wrap_phase(
+                this->phase_operand + operand_type(sample_type(n_samples) * this->delta_phase_per_sample)
+            );
+        }
+
+        public:
+            typedef sample_type sample_type;
+
+            CompactSineOscillator() : CompactSineOscillator(sample_type(0), sample_type(0), sample_type(0)) {}
+
+            CompactSineOscillator(sample_type freq, sample_type ampl, sample_type phase) {
+                this->reset(freq, ampl, phase);
+            }
+
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                this->delta_phase_per_sample = wrap_phase_offset(tau<sample_type>() * freq);
+                this->delta_phase_per_operand = operand_type(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_OPERAND));
+                this->ampl_operand = operand_type(ampl);
+                this->phase_operand = wrap_phase(
+                    operand_type(wrap_phase(phase)) 
+                    + lane_index_operand<sample_type, operand_type>() * operand_type(this->delta_phase_per_sample)
+                );
+            }
+
+            template<typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it)    {
+                
+                if (signal_end_it <= signal_begin_it) {
+                    return;
+                }
+
+                auto signal_it = signal_begin_it;
+
+                for (; signal_end_it - signal_it >= std::ptrdiff_t(N_SAMPLES_PER_OPERAND); signal_it += N_SAMPLES_PER_OPERAND) {
+                    operand_type signal_operand;
+                    load(&(*signal_it), signal_operand);
+                    signal_operand += this->ampl_operand * CosineCalculatorT::cos(this->phase_operand);
+                    store(&(*signal_it), signal_operand);
+
+                    this->phase_operand = wrap_phase_bounded(this->phase_operand + this->delta_phase_per_operand);
+                }
+
+                // The last, partial operand.
+                auto n_remaining_samples = size_t(signal_end_it - signal_it);
+                if (n_remaining_samples > 0) {
+                    sample_type osc_samples[N_SAMPLES_PER_OPERAND];
+                    store(osc_samples, this->ampl_operand * CosineCalculatorT::cos(this->phase_operand));
+
+                    for (size_t i = 0; i < n_remaining_samples; i++) {
+                        signal_it[i] += osc_samples[i];
+                    }
+
+                    this->skip_samples(n_remaining_samples);
+                }
+            }
+        // public
+    };
+}}}
 
 
 
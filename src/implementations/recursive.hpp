@@ -4,29 +4,140 @@
 #include <vector>
 #include <cmath>
 #include <iterator>
-#include <sstream>
-#include <stdexcept>
 #include <array>
 
 #include "common.hpp"
+#include "arena.hpp"
 
 
-namespace goldenrockefeller{ namespace fast_additive_comparison{
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
 
-    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK> 
-    class MagicCircleOscillator{
+    /*
+    Magic-circle recurrence. The co-oscillator is a quarter turn, less half a block phase
+    increment, behind the oscillator.
+    */
+    template <typename sample_type, typename operand_type>
+    class MagicCircleRecurrence {
+        operand_type osc_block_param;
+
+        public:
+            static sample_type co_phase_offset(sample_type freq, std::size_t n_samples_per_block) {
+                auto half_block_phase = wrap_phase(pi<sample_type>() * freq * n_samples_per_block);
+                return half_block_phase - 0.5 * pi<sample_type>();
+            }
+
+            void set_coefficients(sample_type freq, std::size_t n_samples_per_block) {
+                this->osc_block_param = 2. * approx_cos_deg_14(wrap_phase(co_phase_offset(freq, n_samples_per_block)));
+            }
+
+            inline void progress_operands(operand_type& osc_operand, operand_type& co_osc_operand) const {
+                osc_operand  = osc_operand - this->osc_block_param * co_osc_operand; 
+                co_osc_operand  = co_osc_operand + this->osc_block_param * osc_operand; 
+            }
+        // public
+    };
+
+    /*
+    Rotation of a cos/sin pair by the block phase increment, with a complex multiplication. Unlike
+    the magic circle, the rotation does not distort the ellipse at low frequencies, at the cost of
+    two more multiplications per operand. The co-oscillator is the sine.
+    */
+    template <typename sample_type, typename operand_type>
+    class ComplexRotationRecurrence {
+        operand_type block_cos;
+        operand_type block_sin;
+
+        public:
+            static sample_type co_phase_offset(sample_type, std::size_t) {
+                return -0.5 * pi<sample_type>();
+            }
+
+            void set_coefficients(sample_type freq, std::size_t n_samples_per_block) {
+                auto block_phase = wrap_phase(tau<sample_type>() * freq * n_samples_per_block);
+                // The rotation is evaluated once per reset, so it uses the exact functions: its
+                // error would otherwise add up from block to block.
+                this->block_cos = operand_type(std::cos(block_phase));
+                this->block_sin = operand_type(std::sin(block_phase));
+            }
+
+            inline void progress_operands(operand_type& osc_operand, operand_type& co_osc_operand) const {
+                auto prev_osc_operand = osc_operand;
+                osc_operand = prev_osc_operand * this->block_cos - co_osc_operand * this->block_sin;
+                co_osc_operand = co_osc_operand * this->block_cos + prev_osc_operand * this->block_sin;
+            }
+        // public
+    };
+
+    /*
+    Second-order (Chebyshev) recurrence y[n + 1] = 2 cos(w) y[n] - y[n - 1], with w the block phase
+    increment. It needs one multiplication per operand, but the coefficient 2 cos(w) gets close to
+    2 at low frequencies, where its rounding error has the most effect. The co-oscillator is the
+    previous block.
+    */
+    template <typename sample_type, typename operand_type>
+    class ChebyshevRecurrence {
+        operand_type osc_block_param;
+
+        public:
+            static sample_type co_phase_offset(sample_type freq, std::size_t n_samples_per_block) {
+                // The previous block is evaluated one block phase increment (at the final frequency)
+                // behind the current block.
+                return -wrap_phase(tau<sample_type>() * freq * n_samples_per_block);
+            }
+
+            void set_coefficients(sample_type freq, std::size_t n_samples_per_block) {
+                // 2 cos(w) = 2 - 4 sin(w / 2)^2 keeps the precision of the small frequencies.
+                auto block_phase = wrap_phase(tau<sample_type>() * freq * n_samples_per_block);
+                auto half_block_sin = std::sin(0.5 * block_phase);
+                this->osc_block_param = operand_type(sample_type(2.) - sample_type(4.) * half_block_sin * half_block_sin);
+            }
+
+            inline void progress_operands(operand_type& osc_operand, operand_type& co_osc_operand) const {
+                auto prev_osc_operand = osc_operand;
+                osc_operand = this->osc_block_param * osc_operand - co_osc_operand;
+                co_osc_operand = prev_osc_operand;
+            }
+        // public
+    };
+
+    /*
+    Oscillator that steps a recurrence from block to block. RecurrenceT<sample_type, operand_type>
+    is the recurrence: it steps an oscillator operand and a second ("co-oscillator") operand from
+    one block to the next, with coefficients that it sets from the block phase increment. It
+    provides:
+
+        static sample_type co_phase_offset(sample_type freq, size_t n_samples_per_block)
+            Phase of the co-oscillator block relative to the oscillator block.
+        void set_coefficients(sample_type freq, size_t n_samples_per_block)
+        void progress_operands(operand_type& osc_operand, operand_type& co_osc_operand) const
+
+    The recurrence accumulates rounding error in amplitude and phase. With N_BLOCKS_PER_ANCHOR = K
+    > 0, the blocks are re-anchored every K blocks: they are evaluated directly (with
+    approx_cos_deg_14) from the exact phase and amplitude, which the oscillator tracks anyway, so
+    that the drift never builds up for more than K blocks. K = 0 never re-anchors.
+    */
+    template <
+        typename sample_type, 
+        typename operand_type, 
+        std::size_t N_OPERANDS_PER_BLOCK, 
+        template <typename, typename> class RecurrenceT, 
+        typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>, 
+        std::size_t N_BLOCKS_PER_ANCHOR = 0
+    > 
+    class RecursiveOscillator{
         static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
         static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
         static_assert(N_OPERANDS_PER_BLOCK >= 1, "The operand block length must be positive");
 
         using size_t = std::size_t;
-        using vector_type = typename std::vector<sample_type>;
-        using vector_iterator_type = typename std::vector<sample_type>::iterator;
+        using vector_type = typename std::vector<sample_type, BlockAllocatorT>;
+        using vector_iterator_type = typename vector_type::iterator;
+        using block_access = typename allocator_operand_access<operand_type, BlockAllocatorT>::type;
 
         static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
         static constexpr size_t N_SAMPLES_PER_BLOCK = N_OPERANDS_PER_BLOCK * sizeof(operand_type) / sizeof(sample_type);
 
-        operand_type osc_block_param;
+        RecurrenceT<sample_type, operand_type> recurrence;
 
         vector_type osc_block;
         vector_iterator_type osc_block_it;
@@ -35,124 +146,107 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
 
         vector_type co_osc_block;
 
-        static inline void set_osc_operand(sample_type& osc_ref, const sample_type& phase_ref, const operand_type& ampl_operand) {
-            operand_type osc_operand;
-            operand_type phase_operand;
-            load(&phase_ref, phase_operand); 
-            osc_operand  = ampl_operand * approx_cos_deg_14(phase_operand);
-            store(&osc_ref, osc_operand);
-        }
-    
-        static inline void progress_osc_operand(sample_type& osc_ref, sample_type& co_osc_ref, const operand_type& osc_block_param) {
+        PhaseAmplitudeRamp<sample_type, operand_type> param_ramp;
+        size_t n_blocks_since_anchor;
+
+        inline void progress_osc_operand(sample_type& osc_ref, sample_type& co_osc_ref) const {
             operand_type osc_operand;
             operand_type co_osc_operand;
-            load(&osc_ref, osc_operand); 
-            load(&co_osc_ref, co_osc_operand); 
-            osc_operand  = osc_operand - osc_block_param * co_osc_operand; 
-            co_osc_operand  = co_osc_operand + osc_block_param * osc_operand; 
-            store(&osc_ref, osc_operand);
-            store(&co_osc_ref, co_osc_operand); 
+            block_access::load(&osc_ref, osc_operand); 
+            block_access::load(&co_osc_ref, co_osc_operand); 
+            this->recurrence.progress_operands(osc_operand, co_osc_operand);
+            block_access::store(&osc_ref, osc_operand);
+            block_access::store(&co_osc_ref, co_osc_operand); 
         }
     
         public:
             typedef sample_type sample_type;
+            typedef BlockAllocatorT block_allocator_type;
 
-            static void init_phase_block(vector_type& phase_block, sample_type freq, sample_type phase) {
-                if (phase_block.size() !=  N_SAMPLES_PER_BLOCK) {
-                    std::ostringstream msg;
-                    msg << "The phase block size "
-                        << "(phase_block.size() = " << phase_block.size() << ") "
-                        << "must be equal to the number of samples per block "
-                        << "(N_SAMPLES_PER_BLOCK = " << N_SAMPLES_PER_BLOCK << ") ";
-                    throw std::invalid_argument(msg.str());
-                }
-
-                auto delta_phase_per_sample = wrap_phase_offset(tau<sample_type>() * freq);
-                phase = wrap_phase(phase);
+            RecursiveOscillator() : RecursiveOscillator(sample_type(0), sample_type(0), sample_type(0)) {}
 
-                // Fill the first phase operand
-                for (auto it = phase_block.begin(); it < phase_block.begin() + N_SAMPLES_PER_OPERAND; ++it){
-                    *it = phase;
-                    phase += delta_phase_per_sample;
-                    phase = wrap_phase_bounded(phase);
-                }
-
-                operand_type delta_phase_per_operand(wrap_phase_offset(tau<sample_type>() * freq * N_SAMPLES_PER_OPERAND));
+            RecursiveOscillator(sample_type freq, sample_type ampl, sample_type phase) :
+                RecursiveOscillator(freq, ampl, phase, BlockAllocatorT())
+            {}
 
-                // Fill the first phase block
-                operand_type prev_phase_operand;
-                load(phase_block.data(), prev_phase_operand);
-                for (size_t i = N_SAMPLES_PER_OPERAND; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
-                    operand_type phase_operand;
-                    load(&phase_block[i], phase_operand);
-                    phase_operand = wrap_phase_bounded(prev_phase_operand + delta_phase_per_operand);
-                    prev_phase_operand = phase_operand;
-                    store(&phase_block[i], phase_operand);
-                }  
+            RecursiveOscillator(sample_type freq, sample_type ampl, sample_type phase, const BlockAllocatorT& block_allocator) :
+                osc_block(N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND, sample_type(0.), block_allocator),
+                co_osc_block(N_SAMPLES_PER_BLOCK + N_SAMPLES_PER_OPERAND, sample_type(0.), block_allocator)
+            {
+                this->reset(freq, ampl, phase);
             }
-            
-            static vector_type new_phase_block(sample_type freq, sample_type phase) {
 
-                vector_type phase_block(N_SAMPLES_PER_BLOCK, 0.);                
-                MagicCircleOscillator::init_phase_block(phase_block, freq, phase);
-                return phase_block;
+            void reset(sample_type freq, sample_type ampl, sample_type phase) {
+                // Both blocks are re-initialized in place, so a reset never allocates.
+                this->param_ramp.reset(freq, ampl, phase);
+                this->anchor_osc_blocks();
+                this->osc_block_safe_end_it = osc_block.begin() + N_SAMPLES_PER_BLOCK;
+                this->osc_block_safe_begin_it = osc_block.begin() + N_SAMPLES_PER_OPERAND;
+                this->osc_block_it = osc_block.begin()+N_SAMPLES_PER_OPERAND;
             }
 
-            static vector_type new_osc_block(sample_type freq, sample_type ampl, sample_type phase) {
-                auto phase_block = new_phase_block(freq, phase);
-                vector_type osc_block(phase_block.size() + N_SAMPLES_PER_OPERAND, 0.);      
-
-                operand_type ampl_operand(ampl);
+            void anchor_osc_blocks() {
+                // Evaluate both recurrence blocks directly from the ramp's phases and amplitudes
+                // instead of stepping the recurrence.
+                this->n_blocks_since_anchor = 0;
+                auto final_freq = this->param_ramp.final_freq();
+                operand_type co_phase_offset_operand(RecurrenceT<sample_type, operand_type>::co_phase_offset(final_freq, N_SAMPLES_PER_BLOCK));
 
                 for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
-                    MagicCircleOscillator::set_osc_operand(
-                        osc_block[i + N_SAMPLES_PER_OPERAND], 
-                        phase_block[i],
-                        ampl_operand
-                    );
+                    operand_type phase_operand;
+                    operand_type ampl_operand;
+                    this->param_ramp.get_operands(i, phase_operand, ampl_operand);
+                    block_access::store(&this->osc_block[i + N_SAMPLES_PER_OPERAND], ampl_operand * approx_cos_deg_14(phase_operand));
+                    block_access::store(&this->co_osc_block[i + N_SAMPLES_PER_OPERAND], ampl_operand * approx_cos_deg_14(wrap_phase(phase_operand + co_phase_offset_operand)));
                 }
 
-                return osc_block;
-            }
-
-
-            MagicCircleOscillator() : MagicCircleOscillator(sample_type(0), sample_type(0), sample_type(0)) {}
-
-            MagicCircleOscillator(sample_type freq, sample_type ampl, sample_type phase) :
-                osc_block_param(2. * approx_cos_deg_14(wrap_phase(wrap_phase(pi<sample_type>() * freq * N_SAMPLES_PER_BLOCK) - 0.5 * pi<sample_type>()))),
-                osc_block(MagicCircleOscillator::new_osc_block(freq, ampl, phase)),
-                osc_block_safe_end_it(osc_block.begin() + N_SAMPLES_PER_BLOCK),
-                osc_block_safe_begin_it(osc_block.begin() + N_SAMPLES_PER_OPERAND),
-                osc_block_it(osc_block.begin()+N_SAMPLES_PER_OPERAND),
-                co_osc_block(MagicCircleOscillator::new_osc_block(freq, ampl,phase + wrap_phase(pi<sample_type>() * freq * N_SAMPLES_PER_BLOCK) - 0.5 * pi<sample_type>()))
-            {}
-
-            void reset(sample_type freq, sample_type ampl, sample_type phase) {
-                this->osc_block_param = 2. * approx_cos_deg_14(wrap_phase(wrap_phase(pi<sample_type>() * freq * N_SAMPLES_PER_BLOCK) - 0.5 * pi<sample_type>()));
-                this->osc_block = MagicCircleOscillator::new_osc_block(freq, ampl, phase);
-                this->osc_block_safe_end_it = osc_block.begin() + N_SAMPLES_PER_BLOCK;
-                this->osc_block_safe_begin_it = osc_block.begin() + N_SAMPLES_PER_OPERAND;
-                this->osc_block_it = osc_block.begin()+N_SAMPLES_PER_OPERAND;
-                this->co_osc_block = MagicCircleOscillator::new_osc_block(freq, ampl, phase + wrap_phase(pi<sample_type>() * freq * N_SAMPLES_PER_BLOCK) - 0.5 * pi<sample_type>());
+                if (!this->param_ramp.is_ramping()) {
+                    // The block now has a constant phase increment, so the recurrence takes over.
+                    this->recurrence.set_coefficients(final_freq, N_SAMPLES_PER_BLOCK);
+                }
             }
 
             void update_osc_block(size_t sample_offset) {
                 operand_type last_osc_operand;
                 
-                load(&(*this->osc_block_safe_end_it), last_osc_operand);
-                store(this->osc_block.data(), last_osc_operand);
+                block_access::load(&(*this->osc_block_safe_end_it), last_osc_operand);
+                block_access::store(this->osc_block.data(), last_osc_operand);
 
-                for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
-                    MagicCircleOscillator::set_osc_operand(
-                        this->osc_block[i + N_SAMPLES_PER_OPERAND], 
-                        this->co_osc_block[+ N_SAMPLES_PER_OPERAND],
-                        this->osc_block_param
-                    );
+                if (this->param_ramp.is_ramping()) {
+                    this->param_ramp.advance(N_SAMPLES_PER_BLOCK);
+                    this->anchor_osc_blocks();
+                }
+                else if (N_BLOCKS_PER_ANCHOR > 0 && this->n_blocks_since_anchor + 1 >= N_BLOCKS_PER_ANCHOR) {
+                    this->param_ramp.advance(N_SAMPLES_PER_BLOCK);
+                    this->anchor_osc_blocks();
+                }
+                else {
+                    this->param_ramp.advance(N_SAMPLES_PER_BLOCK);
+                    this->n_blocks_since_anchor++;
+                    for (size_t i = 0; i < N_SAMPLES_PER_BLOCK; i += N_SAMPLES_PER_OPERAND) {
+                        this->progress_osc_operand(
+                            this->osc_block[i + N_SAMPLES_PER_OPERAND], 
+                            this->co_osc_block[i + N_SAMPLES_PER_OPERAND]
+                        );
+                    }
                 }
 
                 this->osc_block_it = this->osc_block.begin() + sample_offset;
             }
 
+            /*
+            Glide to a new frequency and amplitude over the next n_samples samples, keeping the
+            phase continuous. While ramping, the blocks are evaluated directly; the recurrence
+            resumes once the ramp is done. n_samples = 0 jumps to the new values without a phase
+            reset.
+            */
+            void ramp(sample_type freq, sample_type ampl, size_t n_samples) {
+                auto sample_id = std::ptrdiff_t(this->osc_block_it - this->osc_block.begin()) - std::ptrdiff_t(N_SAMPLES_PER_OPERAND);
+                this->param_ramp.start(sample_id, freq, ampl, n_samples);
+                this->anchor_osc_blocks();
+                this->osc_block_it = this->osc_block.begin() + N_SAMPLES_PER_OPERAND;
+            }
+
             template<typename iterator_type>
             void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it)    {
                 
@@ -214,7 +308,33 @@ namespace goldenrockefeller{ namespace fast_additive_comparison{
         // public
     };
 
-}}
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>, std::size_t N_BLOCKS_PER_ANCHOR = 0> 
+    using MagicCircleOscillator = RecursiveOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, MagicCircleRecurrence, BlockAllocatorT, N_BLOCKS_PER_ANCHOR>;
+
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>, std::size_t N_BLOCKS_PER_ANCHOR = 0> 
+    using ComplexRotationOscillator = RecursiveOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, ComplexRotationRecurrence, BlockAllocatorT, N_BLOCKS_PER_ANCHOR>;
+
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>, std::size_t N_BLOCKS_PER_ANCHOR = 0> 
+    using ChebyshevOscillator = RecursiveOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, ChebyshevRecurrence, BlockAllocatorT, N_BLOCKS_PER_ANCHOR>;
+
+    /* MagicCircleOscillator that re-anchors every N_BLOCKS_PER_ANCHOR blocks. */
+    template <typename sample_type, typename operand_type, std::size_t N_OPERANDS_PER_BLOCK, std::size_t N_BLOCKS_PER_ANCHOR, typename BlockAllocatorT = AlignedAllocator<sample_type, cache_line_size()>>
+    using AnchoredMagicCircleOscillator = MagicCircleOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, BlockAllocatorT, N_BLOCKS_PER_ANCHOR>;
+
+    template <
+        typename sample_type, 
+        typename operand_type, 
+        std::size_t N_OPERANDS_PER_BLOCK, 
+        template <typename, typename> class RecurrenceT, 
+        std::size_t ALIGNMENT, 
+        std::size_t N_BLOCKS_PER_ANCHOR
+    >
+    struct oscillator_arena_size<RecursiveOscillator<sample_type, operand_type, N_OPERANDS_PER_BLOCK, RecurrenceT, ArenaAllocator<sample_type, ALIGNMENT>, N_BLOCKS_PER_ANCHOR>> {
+        // osc_block and co_osc_block
+        static constexpr std::size_t value = 
+            2 * arena_allocation_size<sample_type, ALIGNMENT>((N_OPERANDS_PER_BLOCK + 1) * sizeof(operand_type) / sizeof(sample_type));
+    };
+}}}
 
 
 
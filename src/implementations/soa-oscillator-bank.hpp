@@ -0,0 +1,174 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_SOA_OSCILLATOR_BANK_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_SOA_OSCILLATOR_BANK_HPP
+#include <cstddef>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Oscillator bank that vectorizes across oscillators instead of across time.
+
+    The phase, phase increment and amplitude of every oscillator are stored as contiguous arrays
+    (structure-of-arrays), so one operand holds the state of N_SAMPLES_PER_OPERAND oscillators. The
+    output is rendered in tiles of N_SAMPLES_PER_TILE samples: each oscillator operand keeps its
+    phase in a register for the whole tile and accumulates into per-sample operand accumulators,
+    which are then reduced and added to the output once per sample.
+    */
+    template <typename sample_type, typename operand_type, typename CosineCalculatorT, std::size_t N_SAMPLES_PER_TILE = 64>
+    class SoaOscillatorBank {
+        static_assert(sizeof(operand_type) >= sizeof(sample_type), "The operand type size must be the same size as sample type");
+        static_assert((sizeof(operand_type) % sizeof(sample_type)) == 0, "The operand type size must be a multiple of size as sample type");
+        static_assert(N_SAMPLES_PER_TILE >= 1, "The tile length must be positive");
+
+        using size_t = std::size_t;
+        using vector_type = typename std::vector<sample_type, AlignedAllocator<sample_type, cache_line_size()>>;
+
+        static constexpr size_t N_SAMPLES_PER_OPERAND = sizeof(operand_type) / sizeof(sample_type);
+
+        size_t n_oscs;
+        vector_type phases;
+        vector_type delta_phases;
+        vector_type ampls;
+
+        static size_t padded_size(size_t n_oscs) {
+            return ((n_oscs + N_SAMPLES_PER_OPERAND - 1) / N_SAMPLES_PER_OPERAND) * N_SAMPLES_PER_OPERAND;
+        }
+
+        template <typename iterator_type>
+        void progress_and_add_tile(iterator_type signal_it, size_t tile_size) {
+            operand_type acc_operands[N_SAMPLES_PER_TILE];
+
+            for (size_t j = 0; j < tile_size; j++) {
+                acc_operands[j] = operand_type(sample_type(0.));
+            }
+
+            for (size_t i = 0; i < this->phases.size(); i += N_SAMPLES_PER_OPERAND) {
+                operand_type phase_operand;
+                operand_type delta_phase_operand;
+                operand_type ampl_operand;
+                load_aligned(&this->phases[i], phase_operand);
+                load_aligned(&this->delta_phases[i], delta_phase_operand);
+                load_aligned(&this->ampls[i], ampl_operand);
+
+                for (size_t j = 0; j < tile_size; j++) {
+                    acc_operands[j] += ampl_operand * CosineCalculatorT::cos(phase_operand);
+                    phase_operand = wrap_phase_bounded(phase_operand + delta_phase_operand);
+                }
+
+                store_aligned(&this->phases[i], phase_operand);
+            }
+
+            for (size_t j = 0; j < tile_size; j++) {
+                signal_it[j] += goldenrockefeller::fast_additive_comparison::reduce_add<sample_type>(acc_operands[j]);
+            }
+        }
+
+        public:
+            typedef sample_type sample_type;
+
+            SoaOscillatorBank() : SoaOscillatorBank(0) {}
+            SoaOscillatorBank(size_t n_oscs) :
+                n_oscs(n_oscs),
+                phases(padded_size(n_oscs), sample_type(0.)),
+                delta_phases(padded_size(n_oscs), sample_type(0.)),
+                ampls(padded_size(n_oscs), sample_type(0.))
+            {}
+
+            void _reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                this->phases[osc_id] = wrap_phase(phase);
+                this->delta_phases[osc_id] = wrap_phase_offset(tau<sample_type>() * freq);
+                this->ampls[osc_id] = ampl;
+            }
+
+            void reset_osc(size_t osc_id, sample_type freq, sample_type ampl, sample_type phase) {
+                if (osc_id >=  this->n_oscs) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(n_oscs = " << this->n_oscs << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                this->_reset_osc(osc_id, freq, ampl, phase);
+            }
+
+            /*
+            Reset oscillators 0 to n_oscs - 1 from contiguous arrays. The state arrays are filled one
+            operand (N_SAMPLES_PER_OPERAND oscillators) at a time.
+            */
+            void reset_oscs(const sample_type* freqs, const sample_type* ampls, const sample_type* phases, size_t n_oscs) {
+                if (n_oscs > this->n_oscs) {
+                    std::ostringstream msg;
+                    msg << "The number of oscilators to reset "
+                        << "(n_oscs = " << n_oscs << ") "
+                        << "must not be greater than the number of oscilators "
+                        << "(this->n_oscs = " << this->n_oscs << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                size_t n_vectorized_oscs = (n_oscs / N_SAMPLES_PER_OPERAND) * N_SAMPLES_PER_OPERAND;
+
+                for (size_t i = 0; i < n_vectorized_oscs; i += N_SAMPLES_PER_OPERAND) {
+                    operand_type freq_operand;
+                    operand_type ampl_operand;
+                    operand_type phase_operand;
+                    load(&freqs[i], freq_operand);
+                    load(&ampls[i], ampl_operand);
+                    load(&phases[i], phase_operand);
+
+                    store_aligned(&this->phases[i], wrap_phase(phase_operand));
+                    store_aligned(&this->delta_phases[i], wrap_phase_offset(operand_type(tau<sample_type>()) * freq_operand));
+                    store_aligned(&this->ampls[i], ampl_operand);
+                }
+
+                for (size_t i = n_vectorized_oscs; i < n_oscs; i++) {
+                    this->_reset_osc(i, freqs[i], ampls[i], phases[i]);
+                }
+            }
+
+            /*
+            Reset the oscillators osc_ids[0] to osc_ids[n_oscs - 1] from contiguous arrays. Every
+            id is checked before any oscillator is reset.
+            */
+            void reset_oscs(const size_t* osc_ids, const sample_type* freqs, const sample_type* ampls, const sample_type* phases, size_t n_oscs) {
+                size_t max_osc_id = 0;
+                for (size_t i = 0; i < n_oscs; i++) {
+                    max_osc_id = std::max(max_osc_id, osc_ids[i]);
+                }
+
+                if (n_oscs > 0 && max_osc_id >= this->n_oscs) {
+                    std::ostringstream msg;
+                    msg << "A valid oscilator id "
+                        << "(osc_id= " << max_osc_id << ") "
+                        << "must less than the number of oscilators "
+                        << "(n_oscs = " << this->n_oscs << ") ";
+                    throw std::invalid_argument(msg.str());
+                }
+
+                for (size_t i = 0; i < n_oscs; i++) {
+                    this->_reset_osc(osc_ids[i], freqs[i], ampls[i], phases[i]);
+                }
+            }
+
+            template <typename iterator_type>
+            void progress_and_add(iterator_type signal_begin_it, iterator_type signal_end_it) {
+                for (auto signal_it = signal_begin_it; signal_it < signal_end_it; signal_it += N_SAMPLES_PER_TILE) {
+                    auto tile_size = std::min(size_t(signal_end_it - signal_it), N_SAMPLES_PER_TILE);
+                    this->progress_and_add_tile(signal_it, tile_size);
+                    if (tile_size < N_SAMPLES_PER_TILE) {
+                        break;
+                    }
+                }
+            }
+        // public
+    };
+}}}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_WORK_STEALING_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_WORK_STEALING_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <atomic>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Lock-free work-stealing scheduler over a fixed list of tasks.
+
+    Each worker owns a contiguous range of task ids, chosen so that every range carries about
+    the same total cost. A worker takes tasks from the front of its own range; once its range
+    is empty it steals tasks from the back of the other workers' ranges. A range is packed into
+    a single 64-bit atomic, so taking and stealing are both a single compare-and-swap.
+    */
+    class WorkStealingScheduler {
+        using size_t = std::size_t;
+        using packed_range_type = std::uint64_t;
+
+        struct TaskRange {
+            std::atomic<packed_range_type> packed;
+            char padding[cache_line_size() - sizeof(std::atomic<packed_range_type>)]; // Keep each range on its own cache line.
+        };
+
+        size_t n_workers;
+        // new[] only guarantees the alignment of a fundamental type, so the ranges come from an
+        // aligned allocator: padded to a cache line, they then start on one.
+        std::vector<TaskRange, AlignedAllocator<TaskRange, cache_line_size()>> ranges;
+
+        static packed_range_type pack(size_t begin_task_id, size_t end_task_id) {
+            return (packed_range_type(begin_task_id) << 32) | packed_range_type(end_task_id);
+        }
+
+        static size_t begin_of(packed_range_type range) {
+            return size_t(range >> 32);
+        }
+
+        static size_t end_of(packed_range_type range) {
+            return size_t(range & 0xffffffffu);
+        }
+
+        bool take_front(size_t worker_id, size_t& task_id) {
+            auto& packed = this->ranges[worker_id].packed;
+            auto range = packed.load(std::memory_order_acquire);
+
+            while (begin_of(range) < end_of(range)) {
+                if (packed.compare_exchange_weak(range, pack(begin_of(range) + 1, end_of(range)), std::memory_order_acq_rel)) {
+                    task_id = begin_of(range);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool steal_back(size_t victim_id, size_t& task_id) {
+            auto& packed = this->ranges[victim_id].packed;
+            auto range = packed.load(std::memory_order_acquire);
+
+            while (begin_of(range) < end_of(range)) {
+                if (packed.compare_exchange_weak(range, pack(begin_of(range), end_of(range) - 1), std::memory_order_acq_rel)) {
+                    task_id = end_of(range) - 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        public:
+            WorkStealingScheduler(size_t n_workers) :
+                n_workers(n_workers),
+                ranges(n_workers)
+            {
+                for (size_t worker_id = 0; worker_id < n_workers; worker_id++) {
+                    this->ranges[worker_id].packed.store(pack(0, 0), std::memory_order_relaxed);
+                }
+            }
+
+            /* Split the tasks into one cost-balanced contiguous range per worker. */
+            void assign(const std::vector<double>& task_costs) {
+                double total_cost = 0.;
+                for (double task_cost : task_costs) {
+                    total_cost += task_cost;
+                }
+
+                size_t task_id = 0;
+                double cost_so_far = 0.;
+                for (size_t worker_id = 0; worker_id < this->n_workers; worker_id++) {
+                    size_t begin_task_id = task_id;
+
+                    if (worker_id + 1 == this->n_workers) {
+                        task_id = task_costs.size();
+                    }
+                    else {
+                        double target_cost = total_cost * double(worker_id + 1) / double(this->n_workers);
+                        while (task_id < task_costs.size() && cost_so_far + 0.5 * task_costs[task_id] <= target_cost) {
+                            cost_so_far += task_costs[task_id];
+                            task_id++;
+                        }
+                    }
+
+                    this->ranges[worker_id].packed.store(pack(begin_task_id, task_id), std::memory_order_release);
+                }
+            }
+
+            /* Get the next task for a worker, stealing one if needed. Returns false once every task is taken. */
+            bool next_task(size_t worker_id, size_t& task_id) {
+                if (this->take_front(worker_id, task_id)) {
+                    return true;
+                }
+
+                for (size_t i = 1; i < this->n_workers; i++) {
+                    if (this->steal_back((worker_id + i) % this->n_workers, task_id)) {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+        // public
+    };
+}}}
+
+#endif
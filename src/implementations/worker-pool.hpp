@@ -0,0 +1,126 @@
+#ifndef GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_WORKER_POOL_HPP
+#define GOLDENROCEKEFELLER_FAST_ADDITIVE_IMPLEMENTATIONS_WORKER_POOL_HPP
+#include <cstddef>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "common.hpp"
+
+
+namespace goldenrockefeller{ namespace fast_additive_comparison{ inline namespace GOLDENROCKEFELLER_FAST_ADDITIVE_COMPARISON_ISA{
+
+    /*
+    Persistent pool of worker threads that run one job at a time on every worker.
+
+    The calling thread takes part in each job as worker 0, so a pool of n_workers starts
+    n_workers - 1 threads. Idle workers spin for a while before blocking, which keeps the
+    hand-off cost low when jobs are issued back-to-back (e.g. once per audio chunk).
+    */
+    class WorkerPool {
+        using size_t = std::size_t;
+        using task_fn_type = void (*)(void*, size_t);
+
+        std::vector<std::thread> threads;
+        std::atomic<size_t> epoch;
+        std::atomic<size_t> n_busy_threads;
+        std::atomic<bool> stopping;
+        std::mutex wake_mutex;
+        std::condition_variable wake_cv;
+        task_fn_type task_fn;
+        void* task_ctx;
+        size_t n_spins;
+
+        template <typename JobT>
+        static void invoke_job(void* job_ptr, size_t worker_id) {
+            (*static_cast<JobT*>(job_ptr))(worker_id);
+        }
+
+        void work(size_t worker_id) {
+            size_t seen_epoch = 0;
+
+            while (true) {
+                size_t n_spins_so_far = 0;
+                while (this->epoch.load(std::memory_order_acquire) == seen_epoch && !this->stopping.load(std::memory_order_acquire)) {
+                    n_spins_so_far++;
+                    if (n_spins_so_far > this->n_spins) {
+                        std::unique_lock<std::mutex> lock(this->wake_mutex);
+                        this->wake_cv.wait(lock, [&] {
+                            return this->epoch.load(std::memory_order_acquire) != seen_epoch || this->stopping.load(std::memory_order_acquire);
+                        });
+                    }
+                }
+
+                if (this->stopping.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                seen_epoch = this->epoch.load(std::memory_order_acquire);
+                this->task_fn(this->task_ctx, worker_id);
+                this->n_busy_threads.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        }
+
+        public:
+            WorkerPool(size_t n_workers, size_t n_spins = 1 << 14) :
+                epoch(0),
+                n_busy_threads(0),
+                stopping(false),
+                task_fn(nullptr),
+                task_ctx(nullptr),
+                n_spins(n_spins)
+            {
+                for (size_t worker_id = 1; worker_id < n_workers; worker_id++) {
+                    this->threads.emplace_back(&WorkerPool::work, this, worker_id);
+                }
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            ~WorkerPool() {
+                {
+                    std::lock_guard<std::mutex> lock(this->wake_mutex);
+                    this->stopping.store(true, std::memory_order_release);
+                }
+                this->wake_cv.notify_all();
+
+                for (std::thread& thread : this->threads) {
+                    thread.join();
+                }
+            }
+
+            size_t n_workers() const {
+                return this->threads.size() + 1;
+            }
+
+            /* Run job(worker_id) on every worker, and return once all workers are done. */
+            template <typename JobT>
+            void run(JobT& job) {
+                this->task_fn = &WorkerPool::invoke_job<JobT>;
+                this->task_ctx = &job;
+                this->n_busy_threads.store(this->threads.size(), std::memory_order_release);
+
+                {
+                    std::lock_guard<std::mutex> lock(this->wake_mutex);
+                    this->epoch.fetch_add(1, std::memory_order_acq_rel);
+                }
+                this->wake_cv.notify_all();
+
+                job(0);
+
+                size_t n_spins_so_far = 0;
+                while (this->n_busy_threads.load(std::memory_order_acquire) != 0) {
+                    n_spins_so_far++;
+                    if (n_spins_so_far > this->n_spins) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        // public
+    };
+}}}
+
+#endif